@@ -0,0 +1,247 @@
+import argparse
+import json
+import os
+import random
+
+# writes synthetic DialogueHistory / ConversationHistory files in the plugin's save format, deterministic from the seed
+
+MONTH_DAYS = (31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31)
+DIALOGUE_TYPES = (2, 3, 4, 5, 6, 7)  # scene, combat, favors, detection, service, misc
+DIALOGUE_TYPE_WEIGHTS = (3, 2, 1, 2, 1, 6)
+
+VOICE_TYPES = ("MaleNord", "FemaleNord", "MaleEvenToned", "FemaleEvenToned", "MaleCommoner", "FemaleCommoner", "MaleGuard", "MaleElfHaughty", "FemaleElfHaughty", "MaleOrc", "FemaleOrc", "MaleKhajiit", "FemaleKhajiit", "MaleArgonian", "FemaleArgonian", "MaleOldGrumpy", "FemaleOldKindly")
+
+FIRST_NAMES = ("Lydia", "Farengar", "Hulda", "Adrianne", "Belethor", "Ysolda", "Brenuin", "Jon", "Olfina", "Idolaf", "Amren", "Saadia", "Nazeem", "Heimskr", "Carlotta", "Mikael", "Uthgerd", "Arcadia", "Eorlund", "Vilkas", "Aela", "Njada", "Ria", "Athis", "Torvar", "Skjor", "Proventus", "Irileth", "Avenicci", "Hrongar")
+EPITHETS = ("", "", "", " the Unbroken", " Gray-Mane", " Battle-Born", " Snow-Shod", " Black-Briar", " the Quiet", " Stone-Fist")
+
+PLACE_PREFIXES = ("Dragon", "Wind", "Frost", "White", "Black", "Bleak", "High", "Iron", "Shadow", "Ember", "Stone", "Raven", "Storm", "Ivory", "Silver")
+PLACE_SUFFIXES = ("reach", "helm", "fall", "hold", "watch", "mere", "shade", "barrow", "hearth", "crag", "rock", "stead", "run", "ford", "spire")
+
+WORDS = ("the", "a", "you", "I", "we", "they", "Jarl", "Hold", "dragon", "city", "road", "guard", "coin", "sword", "mead", "night", "north", "war", "Stormcloaks", "Legion", "gods", "Talos", "Nord", "fire", "snow", "mountain", "need", "want", "heard", "saw", "know", "keep", "trust", "bring", "follow", "careful", "strange", "old", "cold", "quiet", "dangerous", "here", "there", "again", "never", "always", "soon", "today", "with", "without", "about", "from", "into", "over", "and", "but", "or", "if", "when", "is", "are", "was", "be", "not", "my", "your", "their", "this", "that")
+
+def parse_size(a_text):
+	units = { "K": 1 << 10, "M": 1 << 20, "G": 1 << 30 }
+	text = a_text.strip().upper().rstrip("B")
+	if text and text[-1] in units:
+		return int(float(text[:-1]) * units[text[-1]])
+	return int(text)
+
+# BGSNumericIDIndex, a save RefID: two type bits + 22 bit value, high byte first
+def encode_id(a_formID):
+	if a_formID & 0xFFFFFF > 0x3FFFFF:
+		return None
+	if a_formID >> 24 == 0x00:
+		refID = (1 << 22) | (a_formID & 0x3FFFFF)  # Skyrim.esm
+	elif a_formID >> 24 == 0xFF:
+		refID = (2 << 22) | (a_formID & 0x3FFFFF)  # created
+	else:
+		return None  # indexes the save's own form table
+	return [(refID >> 16) & 0xFF, (refID >> 8) & 0xFF, refID & 0xFF]
+
+class Calendar:
+	def __init__(self):
+		self.year = 201
+		self.month = 7  # Last Seed
+		self.day = 17
+		self.minutes = 9 * 60
+
+	def advance(self, a_minutes):
+		self.minutes += max(1, int(a_minutes))
+		while self.minutes >= 24 * 60:
+			self.minutes -= 24 * 60
+			self.day += 1
+			if self.day > MONTH_DAYS[self.month]:
+				self.day = 1
+				self.month += 1
+				if self.month == 12:
+					self.month = 0
+					self.year += 1
+
+	# TimeStamp::GenerateTimeStamp
+	def stamp(self):
+		return int("{:03}{:02}{:02}{:02}{:02}".format(self.year, self.month, self.day, self.minutes // 60, self.minutes % 60))
+
+class Corpus:
+	def __init__(self, a_args):
+		self.args = a_args
+		self.rng = random.Random(a_args.seed)
+
+		self.loadOrder = a_args.load_order
+		self.speakers = list()   # (formID, name, voiceType, homeLocation)
+		self.locations = list()  # (formID, name)
+		self.topics = list()     # (formID, dialogueType)
+
+		if a_args.names:
+			self.load_names(a_args.names)
+		else:
+			self.make_names()
+
+		if not self.speakers or not self.locations or not self.topics:
+			raise SystemExit("No usable speakers, locations or topics")
+
+		self.speakerWeights = [1.0 / (i + 1) for i in range(len(self.speakers))]  # a few NPCs do most of the talking
+
+	# reuse the name snapshot of a real history file, so generated history resolves in game
+	def load_names(self, a_path):
+		data = json.load(open(a_path, encoding="utf-8"))
+		names = data["names"]
+		if self.loadOrder is None:
+			self.loadOrder = names["loadOrder"]
+
+		locations = [(int(formID), name) for formID, name in names["locations"].items() if encode_id(int(formID))]
+		self.locations = sorted(locations)
+		for formID, name in sorted((int(formID), name) for formID, name in names["speakers"].items()):
+			if encode_id(formID):
+				self.speakers.append((formID, name, self.rng.choice(VOICE_TYPES), self.rng.randrange(len(self.locations))))
+		self.topics = sorted((int(formID), dialogueType) for formID, dialogueType in names["topics"].items() if encode_id(int(formID)))
+
+	def make_names(self):
+		if self.loadOrder is None:
+			self.loadOrder = 0
+
+		used = set()
+		for i in range(self.args.locations):
+			name = self.rng.choice(PLACE_PREFIXES) + self.rng.choice(PLACE_SUFFIXES)
+			if name in used:
+				name = "{} {}".format(name, i)
+			used.add(name)
+			self.locations.append((0x00300000 + i, name))
+
+		used.clear()
+		for i in range(self.args.speakers):
+			name = self.rng.choice(FIRST_NAMES) + self.rng.choice(EPITHETS)
+			if name in used:
+				name = "{} {}".format(name, i)
+			used.add(name)
+			self.speakers.append((0x00340000 + i, name, self.rng.choice(VOICE_TYPES), self.rng.randrange(len(self.locations))))
+
+		for i in range(self.args.topics):
+			self.topics.append((0x00380000 + i, self.rng.choices(DIALOGUE_TYPES, DIALOGUE_TYPE_WEIGHTS)[0]))
+
+	def make_snapshot(self):
+		return {
+			"loadOrder": self.loadOrder,
+			"speakers": { str(formID): name for formID, name, _, _ in self.speakers },
+			"locations": { str(formID): name for formID, name in self.locations },
+			"topics": { str(formID): dialogueType for formID, dialogueType in self.topics }
+		}
+
+	def make_text(self):
+		words = [self.rng.choice(WORDS) for _ in range(self.rng.randint(self.args.min_words, self.args.max_words))]
+		text = " ".join(words)
+		return text[0].upper() + text[1:] + self.rng.choice((".", ".", "?", "!"))
+
+	def make_voice(self, a_speaker, a_topic):
+		# relative to Data, as stored after the "Data\" prefix is stripped
+		return "Sound\\Voice\\Skyrim.esm\\{}\\{:08X}_{}.fuz".format(a_speaker[2], a_topic, self.rng.randint(1, 9))
+
+	def pick_speaker(self):
+		speaker = self.rng.choices(self.speakers, self.speakerWeights)[0]
+		if self.rng.random() < 0.8:
+			location = self.locations[speaker[3]]
+		else:
+			location = self.rng.choice(self.locations)
+		return speaker, location
+
+	def make_dialogue(self, a_calendar):
+		speaker, location = self.pick_speaker()
+		topic = self.rng.choice(self.topics)[0]
+
+		lines = list()
+		for i in range(self.rng.randint(self.args.min_lines, self.args.max_lines)):
+			if i % 2 == 0:
+				lines.append({ "line": self.make_text(), "wav": self.make_voice(speaker, topic) })
+			else:
+				lines.append({ "line": self.make_text(), "wav": "" })  # player lines have no voice
+
+		return {
+			"time": a_calendar.stamp(),
+			"id": encode_id(speaker[0]),
+			"loc": encode_id(location[0]),
+			"lines": lines
+		}
+
+	def make_monologue(self, a_calendar, a_barks):
+		speaker, location = self.pick_speaker()
+
+		barks = a_barks.setdefault(speaker[0], list())
+		if barks and self.rng.random() < self.args.bark_repeat:
+			line, topic = self.rng.choice(barks)
+		else:
+			topic = self.rng.choice(self.topics)[0]
+			line = { "line": self.make_text(), "wav": self.make_voice(speaker, topic) }
+			barks.append((line, topic))
+
+		return {
+			"time": a_calendar.stamp(),
+			"id": encode_id(speaker[0]),
+			"loc": encode_id(location[0]),
+			"line": line,
+			"topic": encode_id(topic)
+		}
+
+	# entries are written as they are made, so output size isn't limited by memory
+	def write(self, a_path, a_make_entry, a_size):
+		os.makedirs(os.path.dirname(a_path), exist_ok=True)
+
+		# spread the entries evenly over the requested span of game days
+		sample = Corpus(self.args)
+		sampleCalendar = Calendar()
+		sampleState = dict()
+		sampleBytes = sum(len(dump(a_make_entry(sample, sampleCalendar, sampleState))) + 1 for _ in range(256))
+		count = max(1, a_size * 256 // sampleBytes)
+		step = self.args.days * 24 * 60 / count
+
+		calendar = Calendar()
+		state = dict()
+
+		with open(a_path, "w", encoding="utf-8", newline="") as out:
+			header = '{"names":' + dump(self.make_snapshot()) + ',"history":['
+			out.write(header)
+
+			written = len(header.encode("utf-8"))
+			entries = 0
+			while written < a_size or entries == 0:
+				calendar.advance(self.rng.uniform(0.5, 1.5) * step)
+				entry = dump(a_make_entry(self, calendar, state))
+				if entries > 0:
+					out.write(",")
+					written += 1
+				out.write(entry)
+				written += len(entry.encode("utf-8"))
+				entries += 1
+
+			out.write("]}")
+
+		print("{} : {} entries, {} bytes".format(a_path, entries, written + 2))
+
+def dump(a_value):
+	return json.dumps(a_value, ensure_ascii=False, separators=(",", ":"))
+
+def main():
+	parser = argparse.ArgumentParser(description="Generate synthetic DialogueHistory and ConversationHistory files")
+	parser.add_argument("--seed", type=int, default=0)
+	parser.add_argument("--out", default="Corpus", help="written as <out>/DialogueHistory/<save>.json and <out>/ConversationHistory/<save>.json")
+	parser.add_argument("--save", default="Corpus", help="save file name, without extension")
+	parser.add_argument("--size", type=parse_size, default=parse_size("1M"), help="approximate size of each file, ie. 1M, 64M, 1G")
+	parser.add_argument("--speakers", type=int, default=200)
+	parser.add_argument("--locations", type=int, default=40)
+	parser.add_argument("--topics", type=int, default=2000)
+	parser.add_argument("--min-lines", type=int, default=2, help="lines per dialogue")
+	parser.add_argument("--max-lines", type=int, default=24)
+	parser.add_argument("--min-words", type=int, default=3, help="words per line")
+	parser.add_argument("--max-words", type=int, default=30)
+	parser.add_argument("--bark-repeat", type=float, default=0.6, help="chance an NPC repeats a line it has already said")
+	parser.add_argument("--days", type=int, default=365, help="game days covered by the history")
+	parser.add_argument("--load-order", type=int, default=None, help="name snapshot fingerprint, saved names are only trusted when it matches the game's")
+	parser.add_argument("--names", default=None, help="history file to take speakers, locations, topics and load order from")
+	args = parser.parse_args()
+
+	if args.min_lines < 1 or args.max_lines < args.min_lines or args.min_words < 1 or args.max_words < args.min_words:
+		parser.error("invalid line or word range")
+
+	Corpus(args).write(os.path.join(args.out, "DialogueHistory", args.save + ".json"), lambda a_corpus, a_calendar, a_state: a_corpus.make_dialogue(a_calendar), args.size)
+	Corpus(args).write(os.path.join(args.out, "ConversationHistory", args.save + ".json"), lambda a_corpus, a_calendar, a_state: a_corpus.make_monologue(a_calendar, a_state), args.size)
+
+if __name__ == "__main__":
+	main()
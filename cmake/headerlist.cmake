@@ -1,21 +1,36 @@
 set(headers ${headers}
+	src/Capture.h
+	src/CapturePipeline.h
+	src/CaptureQueue.h
+	src/CaptureSession.h
 	src/Compatibility.h
 	src/Dialogue.h
 	src/GlobalHistory.h
+	src/HistoryFilter.h
 	src/Hooks.h
 	src/Hotkeys.h
 	src/ImGui/Backend/imgui_impl_win32.h
 	src/ImGui/Graphics.h
 	src/ImGui/IconsFonts.h
+	src/ImGui/ImageDecoder.h
 	src/ImGui/Renderer.h
+	src/ImGui/ShelfPacker.h
 	src/ImGui/Styles.h
 	src/ImGui/Util.h
 	src/Input.h
+	src/InputRecorder.h
+	src/KeyChord.h
 	src/LocalHistory.h
+	src/MemoryReport.h
 	src/NND_API.h
 	src/NPCNameProvider.h
 	src/PCH.h
 	src/Papyrus.h
+	src/Profiler.h
 	src/Settings.h
+	src/TimeStampKey.h
 	src/Translation.h
+	src/TranslationTable.h
+	src/Voice.h
+	src/VoicePlayer.h
 )
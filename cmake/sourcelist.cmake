@@ -1,21 +1,34 @@
 set(sources ${sources}
+	src/Capture.cpp
+	src/CapturePipeline.cpp
+	src/CaptureSession.cpp
 	src/Compatibility.cpp
 	src/Dialogue.cpp
 	src/GlobalHistory.cpp
+	src/GlobalHistoryData.cpp
 	src/Hooks.cpp
 	src/Hotkeys.cpp
 	src/ImGui/Backend/imgui_impl_win32.cpp
 	src/ImGui/Graphics.cpp
 	src/ImGui/IconsFonts.cpp
+	src/ImGui/ImageDecoder.cpp
 	src/ImGui/Renderer.cpp
+	src/ImGui/ShelfPacker.cpp
 	src/ImGui/Styles.cpp
 	src/ImGui/Util.cpp
 	src/Input.cpp
+	src/InputQueue.cpp
+	src/InputRecorder.cpp
+	src/KeyChord.cpp
 	src/LocalHistory.cpp
+	src/MemoryReport.cpp
 	src/NPCNameProvider.cpp
 	src/PCH.cpp
 	src/Papyrus.cpp
+	src/Profiler.cpp
 	src/Settings.cpp
 	src/Translation.cpp
+	src/Voice.cpp
+	src/VoicePlayer.cpp
 	src/main.cpp
 )
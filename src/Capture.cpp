@@ -0,0 +1,136 @@
+#include "Capture.h"
+
+#include "GlobalHistory.h"
+#include "LocalHistory.h"
+#include "Profiler.h"
+
+namespace Capture
+{
+	void EngineSink::AddPlayerLine(std::string_view a_text)
+	{
+		MANAGER(LocalHistory)->AddDialogue(RE::PlayerCharacter::GetSingleton(), std::string(a_text), {});
+	}
+
+	void EngineSink::AddSpeakerLine(std::uint32_t a_speaker, std::string_view a_text, std::string_view a_voice)
+	{
+		if (const auto speaker = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_speaker)) {
+			MANAGER(LocalHistory)->AddDialogue(speaker, std::string(a_text), std::string(a_voice));
+		}
+	}
+
+	void EngineSink::AddConversations(std::span<const TopicEnd> a_topics)
+	{
+		MANAGER(GlobalHistory)->AddConversations(a_topics);
+	}
+
+	// the file is opened or closed on the next drain
+	void Manager::LoadMCMSettings(const CSimpleIniA& a_ini)
+	{
+		recordSession = a_ini.GetBoolValue("Settings", "bRecordCapture", recordSession);
+	}
+
+	void Manager::Register()
+	{
+		consumerThread = std::this_thread::get_id();
+	}
+
+	// game time is taken here rather than at drain, lines keep the time they were spoken
+	void Manager::Push(Record& a_record)
+	{
+		a_record.time = RE::Calendar::GetSingleton()->GetTime();
+		pipeline.Push(a_record);
+	}
+
+	// the queue has a single consumer, every drain site must run on the main thread
+	bool Manager::IsConsumerThread() const
+	{
+		if (consumerThread == std::thread::id{} || consumerThread == std::this_thread::get_id()) {
+			return true;
+		}
+		logger::critical("Capture queue drained off the main thread, skipped");
+		return false;
+	}
+
+	void Manager::Drain()
+	{
+		if (!IsConsumerThread()) {
+			return;
+		}
+
+		Profiler::ScopedTimer timer(Profiler::SECTION::kCapture);
+
+		UpdateSessionRecording();
+
+		if (session.IsOpen()) {
+			if (pipeline.Drain(sink, [this](const Record& a_record) { session.Write(a_record); }) > 0) {
+				session.Write(Session::EVENT::kDrain);
+			}
+		} else {
+			pipeline.Drain(sink);
+		}
+
+		if (const auto dropped = pipeline.TakeDropped(); dropped > 0) {
+			logger::warn("Capture queue full, dropped {} lines", dropped);
+		}
+	}
+
+	// records from the previous save are stale
+	void Manager::Clear()
+	{
+		if (!IsConsumerThread()) {
+			return;
+		}
+
+		pipeline.Clear();
+	}
+
+	void Manager::LogLatency()
+	{
+		if (const auto& latency = pipeline.GetLatency(); latency.count > 0) {
+			logger::info("Capture latency : {} records, avg {:.2f} ms, max {:.2f} ms", latency.count, latency.total / 1000.0 / latency.count, latency.max / 1000.0);
+		}
+		pipeline.ResetLatency();
+	}
+
+	void Manager::RecordEvent(Session::EVENT a_type, std::uint32_t a_value)
+	{
+		if (!IsConsumerThread()) {
+			return;
+		}
+
+		UpdateSessionRecording();
+		session.Write(a_type, a_value);
+	}
+
+	std::optional<std::filesystem::path> Manager::GetSessionPath()
+	{
+		if (auto path = logger::log_directory()) {
+			*path /= "DialogueHistory_Capture.bin";
+			return path;
+		}
+		return std::nullopt;
+	}
+
+	void Manager::UpdateSessionRecording()
+	{
+		const bool record = recordSession.load();
+		if (record == session.IsOpen()) {
+			return;
+		}
+
+		if (!record) {
+			session.Close();
+			logger::info("Recorded {} capture events", session.GetCount());
+			return;
+		}
+
+		const auto path = GetSessionPath();
+		if (!path || !session.Open(*path)) {
+			logger::error("Unable to open capture session file");
+			recordSession = false;
+			return;
+		}
+
+		logger::info("Recording capture session to {}", path->string());
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CaptureSession.h"
+
+namespace Capture
+{
+	// local and global history
+	class EngineSink : public ISink
+	{
+	public:
+		void AddPlayerLine(std::string_view a_text) override;
+		void AddSpeakerLine(std::uint32_t a_speaker, std::string_view a_text, std::string_view a_voice) override;
+		void AddConversations(std::span<const TopicEnd> a_topics) override;
+	};
+
+	// engine hooks only push records, history is updated when the queue is drained on the main thread
+	class Manager : public REX::Singleton<Manager>
+	{
+	public:
+		void LoadMCMSettings(const CSimpleIniA& a_ini);
+
+		void Register();  // on the main thread, which becomes the only consumer
+
+		void Push(Record& a_record);
+
+		void Drain();
+		void Clear();
+
+		void LogLatency();  // hook to drain, since the last call
+
+		void RecordEvent(Session::EVENT a_type, std::uint32_t a_value = 0);  // game events around the records, while recording a session
+
+	private:
+		static std::optional<std::filesystem::path> GetSessionPath();
+
+		bool IsConsumerThread() const;
+		void UpdateSessionRecording();
+
+		// members
+		EngineSink        sink{};
+		Pipeline          pipeline{};
+		std::thread::id   consumerThread{};
+		std::atomic<bool> recordSession{ false };
+		Session::Writer   session{};
+	};
+}
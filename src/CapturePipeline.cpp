@@ -0,0 +1,124 @@
+#include "CapturePipeline.h"
+
+namespace Capture
+{
+	template <std::size_t N>
+	void CopyString(std::array<char, N>& a_dst, std::string_view a_src)
+	{
+		auto size = std::min(a_src.size(), N - 1);
+		if (size < a_src.size()) {
+			// don't split a multibyte character
+			while (size > 0 && (static_cast<std::uint8_t>(a_src[size]) & 0xC0) == 0x80) {
+				size--;
+			}
+		}
+		std::memcpy(a_dst.data(), a_src.data(), size);
+		a_dst[size] = '\0';
+	}
+
+	void Record::SetText(std::string_view a_text)
+	{
+		CopyString(text, a_text);
+	}
+
+	void Record::SetVoice(std::string_view a_voice)
+	{
+		CopyString(voice, a_voice);
+	}
+
+	void RemoveDuplicateTopics(std::vector<TopicEnd>& a_topics, TopicKeys& a_keys)
+	{
+		a_keys.clear();
+		for (std::uint32_t i = 0; i < a_topics.size(); i++) {
+			a_keys.emplace_back(static_cast<std::uint64_t>(a_topics[i].speaker) << 32 | a_topics[i].topicInfo, i);
+		}
+
+		// by key then index, so unique keeps the earliest of each line
+		std::ranges::sort(a_keys);
+		const auto duplicates = std::ranges::unique(a_keys, {}, &TopicKeys::value_type::first);
+		if (duplicates.empty()) {
+			return;
+		}
+		a_keys.erase(duplicates.begin(), duplicates.end());
+
+		// back to arrival order, compacted in place since every kept index is at or past its new position
+		std::ranges::sort(a_keys, {}, &TopicKeys::value_type::second);
+
+		std::size_t count = 0;
+		for (const auto index : a_keys | std::views::values) {
+			a_topics[count++] = a_topics[index];
+		}
+		a_topics.resize(count);
+	}
+
+	void Pipeline::Push(Record& a_record)
+	{
+		a_record.pushTime = clock::now();
+		if (!queue.push(std::move(a_record))) {
+			dropped.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	std::size_t Pipeline::Drain(ISink& a_sink, const Observer& a_observer)
+	{
+		std::size_t count = 0;
+
+		Record record;
+		while (queue.pop(record)) {
+			// sampled per record, a line pushed while the drain runs is never timed against an earlier now
+			const auto us = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - record.pushTime).count();
+			latency.count++;
+			latency.total += us;
+			latency.max = std::max(latency.max, us);
+
+			count++;
+			if (a_observer) {
+				a_observer(record);
+			}
+
+			switch (record.type) {
+			case TYPE::kPlayerLine:
+				a_sink.AddPlayerLine(record.GetText());
+				break;
+			case TYPE::kSpeakerLine:
+				{
+					auto voice = record.GetVoice();
+					if (!voice.empty()) {
+						// Strip "Data\"
+						voice.remove_prefix(std::min<std::size_t>(5, voice.size()));
+					}
+					const auto subtitle = record.GetText();
+					a_sink.AddSpeakerLine(record.speaker, (subtitle.empty() || subtitle == " ") ? "..."sv : subtitle, voice);
+				}
+				break;
+			case TYPE::kTopicEnd:
+				topicEnds.emplace_back(record.speaker, record.topicInfo, record.time);
+				break;
+			default:
+				break;
+			}
+		}
+
+		if (!topicEnds.empty()) {
+			RemoveDuplicateTopics(topicEnds, topicKeys);
+			a_sink.AddConversations(topicEnds);
+			topicEnds.clear();
+		}
+
+		return count;
+	}
+
+	// records from the previous save are stale
+	void Pipeline::Clear()
+	{
+		Record record;
+		while (queue.pop(record)) {}
+		dropped.store(0, std::memory_order_relaxed);
+		latency = {};
+	}
+
+	std::size_t Pipeline::TakeDropped()
+	{
+		return dropped.exchange(0, std::memory_order_relaxed);
+	}
+}
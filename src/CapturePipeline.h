@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CaptureQueue.h"
+
+namespace Capture
+{
+	using clock = std::chrono::steady_clock;
+
+	enum class TYPE : std::uint8_t
+	{
+		kPlayerLine,   // topic selected in the dialogue menu
+		kSpeakerLine,  // subtitle shown
+		kTopicEnd      // NPC finished a line, for conversation history
+	};
+
+	// fixed size and engine free, so pushing from a hook never allocates, locks or interns strings
+	struct Record
+	{
+		void SetText(std::string_view a_text);
+		void SetVoice(std::string_view a_voice);
+
+		std::string_view GetText() const { return text.data(); }
+		std::string_view GetVoice() const { return voice.data(); }
+
+		// members
+		TYPE                  type{ TYPE::kPlayerLine };
+		std::uint32_t         speaker{ 0 };    // FormID
+		std::uint32_t         topicInfo{ 0 };  // FormID
+		std::tm               time{};          // game time, set by Manager::Push
+		clock::time_point     pushTime{};      // set by Pipeline::Push
+		std::array<char, 512> text{};          // truncated on a UTF-8 boundary
+		std::array<char, 260> voice{};
+	};
+	static_assert(std::is_trivially_copyable_v<Record>);
+
+	struct TopicEnd
+	{
+		std::uint32_t speaker{ 0 };
+		std::uint32_t topicInfo{ 0 };
+		std::tm       time{};
+	};
+
+	// where drained records end up, local and global history in game, a stand-in in the replay driver
+	class ISink
+	{
+	public:
+		virtual ~ISink() = default;
+
+		virtual void AddPlayerLine(std::string_view a_text) = 0;
+		virtual void AddSpeakerLine(std::uint32_t a_speaker, std::string_view a_text, std::string_view a_voice) = 0;  // voice without "Data\"
+		virtual void AddConversations(std::span<const TopicEnd> a_topics) = 0;                                        // every topic end of one drain, each line once
+	};
+
+	// (speaker << 32 | topicInfo, index), scratch for RemoveDuplicateTopics
+	using TopicKeys = std::vector<std::pair<std::uint64_t, std::uint32_t>>;
+
+	// the same line can be reported more than once a frame. Keeps the first topic end of each speaker and topic info, in
+	// order, by sorting keys instead of comparing every pair. a_keys is kept between calls so it stops allocating
+	void RemoveDuplicateTopics(std::vector<TopicEnd>& a_topics, TopicKeys& a_keys);
+
+	struct Latency
+	{
+		std::size_t  count{ 0 };
+		std::int64_t total{ 0 };  // us
+		std::int64_t max{ 0 };    // us
+	};
+
+	// records are pushed from any thread and drained into a sink by a single consumer
+	class Pipeline
+	{
+	public:
+		using Observer = std::function<void(const Record&)>;
+
+		void        Push(Record& a_record);
+		std::size_t Drain(ISink& a_sink, const Observer& a_observer = {});  // returns the number of records drained
+		void        Clear();
+
+		std::size_t    TakeDropped();  // pushed while the queue was full, since the last call
+		const Latency& GetLatency() const { return latency; }
+		void           ResetLatency() { latency = {}; }
+
+	private:
+		// members
+		Queue<Record, 256>       queue{};
+		std::atomic<std::size_t> dropped{ 0 };
+		std::vector<TopicEnd>    topicEnds{};  // batched per drain
+		TopicKeys                topicKeys{};
+		Latency                  latency{};
+	};
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+namespace Capture
+{
+	// bounded multi-producer, single-consumer ring buffer (Vyukov)
+	template <class T, std::size_t N>
+	class Queue
+	{
+		static_assert(std::has_single_bit(N));
+
+	public:
+		Queue()
+		{
+			for (std::size_t i = 0; i < N; i++) {
+				cells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		// returns false if the queue is full
+		bool push(T&& a_value)
+		{
+			auto pos = enqueuePos.load(std::memory_order_relaxed);
+			for (;;) {
+				auto&      cell = cells[pos & (N - 1)];
+				const auto seq = cell.sequence.load(std::memory_order_acquire);
+				const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+				if (diff == 0) {
+					if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						cell.value = std::move(a_value);
+						cell.sequence.store(pos + 1, std::memory_order_release);
+						return true;
+					}
+				} else if (diff < 0) {
+					return false;
+				} else {
+					pos = enqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// consumer thread only
+		bool pop(T& a_value)
+		{
+			auto&      cell = cells[dequeuePos & (N - 1)];
+			const auto seq = cell.sequence.load(std::memory_order_acquire);
+			if (static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(dequeuePos + 1) < 0) {
+				return false;
+			}
+			a_value = std::move(cell.value);
+			if constexpr (!std::is_trivially_copyable_v<T>) {
+				cell.value = T{};
+			}
+			cell.sequence.store(dequeuePos + N, std::memory_order_release);
+			dequeuePos++;
+			return true;
+		}
+
+	private:
+		struct alignas(64) Cell
+		{
+			std::atomic<std::size_t> sequence{ 0 };
+			T                        value{};
+		};
+
+		// members
+		std::array<Cell, N>                  cells{};
+		alignas(64) std::atomic<std::size_t> enqueuePos{ 0 };
+		alignas(64) std::size_t              dequeuePos{ 0 };
+	};
+}
@@ -0,0 +1,212 @@
+#include "CaptureSession.h"
+
+namespace Capture::Session
+{
+	static constexpr std::uint32_t magic{ 0x53434844 };  // "DHCS"
+	static constexpr std::uint32_t version{ 1 };
+
+	template <class T>
+	void WriteValue(std::ostream& a_stream, const T& a_value)
+	{
+		a_stream.write(reinterpret_cast<const char*>(&a_value), sizeof(a_value));
+	}
+
+	template <class T>
+	void ReadValue(std::istream& a_stream, T& a_value)
+	{
+		a_stream.read(reinterpret_cast<char*>(&a_value), sizeof(a_value));
+	}
+
+	// [size : u16][size * char]
+	void WriteString(std::ostream& a_stream, std::string_view a_string)
+	{
+		const auto size = static_cast<std::uint16_t>(a_string.size());
+		WriteValue(a_stream, size);
+		a_stream.write(a_string.data(), size);
+	}
+
+	template <std::size_t N>
+	void ReadString(std::istream& a_stream, std::array<char, N>& a_string)
+	{
+		std::uint16_t size = 0;
+		ReadValue(a_stream, size);
+		if (size >= N) {
+			a_stream.setstate(std::ios::failbit);
+			return;
+		}
+		a_stream.read(a_string.data(), size);
+		a_string[size] = '\0';
+	}
+
+	void WriteHeader(std::ostream& a_stream)
+	{
+		WriteValue(a_stream, magic);
+		WriteValue(a_stream, version);
+	}
+
+	bool ReadHeader(std::istream& a_stream)
+	{
+		std::uint32_t fileMagic = 0;
+		std::uint32_t fileVersion = 0;
+		ReadValue(a_stream, fileMagic);
+		ReadValue(a_stream, fileVersion);
+
+		return a_stream.good() && fileMagic == magic && fileVersion == version;
+	}
+
+	// [type : u8][time : u64][value : u32], records add
+	// [type : u8][speaker : u32][topicInfo : u32][year, month, day, hour, minute : i32][text][voice]
+	void WriteEvent(std::ostream& a_stream, const Event& a_event)
+	{
+		WriteValue(a_stream, std::to_underlying(a_event.type));
+		WriteValue(a_stream, a_event.time);
+		WriteValue(a_stream, a_event.value);
+
+		if (a_event.type == EVENT::kRecord) {
+			const auto& record = a_event.record;
+
+			WriteValue(a_stream, std::to_underlying(record.type));
+			WriteValue(a_stream, record.speaker);
+			WriteValue(a_stream, record.topicInfo);
+			for (const auto field : { record.time.tm_year, record.time.tm_mon, record.time.tm_mday, record.time.tm_hour, record.time.tm_min }) {
+				WriteValue(a_stream, static_cast<std::int32_t>(field));
+			}
+			WriteString(a_stream, record.GetText());
+			WriteString(a_stream, record.GetVoice());
+		}
+	}
+
+	bool ReadEvent(std::istream& a_stream, Event& a_event)
+	{
+		std::underlying_type_t<EVENT> type = 0;
+		ReadValue(a_stream, type);
+		ReadValue(a_stream, a_event.time);
+		ReadValue(a_stream, a_event.value);
+
+		a_event.type = static_cast<EVENT>(type);
+		a_event.record = {};
+
+		if (a_event.type == EVENT::kRecord) {
+			auto& record = a_event.record;
+
+			std::underlying_type_t<TYPE> recordType = 0;
+			ReadValue(a_stream, recordType);
+			ReadValue(a_stream, record.speaker);
+			ReadValue(a_stream, record.topicInfo);
+			for (const auto field : { &record.time.tm_year, &record.time.tm_mon, &record.time.tm_mday, &record.time.tm_hour, &record.time.tm_min }) {
+				std::int32_t value = 0;
+				ReadValue(a_stream, value);
+				*field = value;
+			}
+			ReadString(a_stream, record.text);
+			ReadString(a_stream, record.voice);
+
+			record.type = static_cast<TYPE>(recordType);
+		}
+
+		return a_stream.good();
+	}
+
+	std::optional<std::vector<Event>> Load(const std::filesystem::path& a_path)
+	{
+		std::ifstream file(a_path, std::ios::binary);
+		if (!file.good() || !ReadHeader(file)) {
+			return std::nullopt;
+		}
+
+		std::vector<Event> events;
+
+		Event event;
+		while (ReadEvent(file, event)) {
+			events.push_back(event);
+		}
+
+		return events;
+	}
+
+	bool Writer::Open(const std::filesystem::path& a_path)
+	{
+		Close();
+
+		file.open(a_path, std::ios::binary | std::ios::trunc);
+		if (!file.good()) {
+			file.close();
+			return false;
+		}
+
+		WriteHeader(file);
+
+		start = clock::now();
+		count = 0;
+
+		return true;
+	}
+
+	void Writer::Close()
+	{
+		file.close();
+	}
+
+	std::uint64_t Writer::GetTime(clock::time_point a_time) const
+	{
+		// records pushed before recording started
+		if (a_time < start) {
+			return 0;
+		}
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(a_time - start).count());
+	}
+
+	void Writer::Write(EVENT a_type, std::uint32_t a_value)
+	{
+		if (!IsOpen()) {
+			return;
+		}
+
+		WriteEvent(file, { .type = a_type, .time = GetTime(clock::now()), .value = a_value });
+		count++;
+	}
+
+	void Writer::Write(const Record& a_record)
+	{
+		if (!IsOpen()) {
+			return;
+		}
+
+		WriteEvent(file, { .type = EVENT::kRecord, .time = GetTime(a_record.pushTime), .record = a_record });
+		count++;
+	}
+
+	// same order as the plugin : each site drains before it acts, a load drops what was queued
+	void Replay(const Event& a_event, Pipeline& a_pipeline, IHost& a_host)
+	{
+		switch (a_event.type) {
+		case EVENT::kRecord:
+			{
+				auto record = a_event.record;
+				a_pipeline.Push(record);
+			}
+			break;
+		case EVENT::kDrain:
+			a_pipeline.Drain(a_host);
+			break;
+		case EVENT::kDialogueMenu:
+			a_pipeline.Drain(a_host);
+			a_host.SetDialogueMenuOpen(a_event.value != 0);
+			break;
+		case EVENT::kSave:
+			a_pipeline.Drain(a_host);
+			a_host.SaveFiles();
+			break;
+		case EVENT::kLoad:
+			a_pipeline.Clear();
+			a_host.LoadFiles();
+			break;
+		case EVENT::kNewGame:
+			a_pipeline.Clear();
+			a_host.Clear();
+			break;
+		default:
+			break;
+		}
+	}
+}
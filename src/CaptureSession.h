@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CapturePipeline.h"
+
+// a recorded play session, the drained capture records and the game events around them, replayed headless
+namespace Capture::Session
+{
+	enum class EVENT : std::uint8_t
+	{
+		kRecord,        // a drained record, at its push time
+		kDrain,         // the drain that took the records before it
+		kDialogueMenu,  // value is 1 when opened
+		kSave,
+		kLoad,
+		kNewGame
+	};
+
+	struct Event
+	{
+		// members
+		EVENT         type{ EVENT::kRecord };
+		std::uint64_t time{ 0 };   // us since recording started
+		std::uint32_t value{ 0 };  // kDialogueMenu only
+		Record        record{};    // kRecord only
+	};
+
+	// field by field, so struct padding never reaches the file
+	void WriteHeader(std::ostream& a_stream);
+	bool ReadHeader(std::istream& a_stream);
+
+	void WriteEvent(std::ostream& a_stream, const Event& a_event);
+	bool ReadEvent(std::istream& a_stream, Event& a_event);
+
+	std::optional<std::vector<Event>> Load(const std::filesystem::path& a_path);  // nullopt if not a session file, stops at a truncated event
+
+	class Writer
+	{
+	public:
+		bool Open(const std::filesystem::path& a_path);
+		void Close();
+		bool IsOpen() const { return file.is_open(); }
+
+		void        Write(EVENT a_type, std::uint32_t a_value = 0);  // now
+		void        Write(const Record& a_record);                   // at its push time
+		std::size_t GetCount() const { return count; }
+
+	private:
+		std::uint64_t GetTime(clock::time_point a_time) const;
+
+		// members
+		std::ofstream     file{};
+		clock::time_point start{};
+		std::size_t       count{ 0 };
+	};
+
+	// the game side of a replay, in the order the plugin handles each event
+	class IHost : public ISink
+	{
+	public:
+		virtual void SetDialogueMenuOpen(bool a_opened) = 0;
+		virtual void SaveFiles() = 0;
+		virtual void LoadFiles() = 0;
+		virtual void Clear() = 0;  // new game
+	};
+
+	void Replay(const Event& a_event, Pipeline& a_pipeline, IHost& a_host);
+}
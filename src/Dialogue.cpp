@@ -3,6 +3,7 @@
 #include "GlobalHistory.h"
 #include "ImGui/Styles.h"
 #include "NPCNameProvider.h"
+#include "Voice.h"
 
 TimeStamp::TimeStamp(std::uint64_t a_timeStamp, const std::string& a_format) :
 	time(a_timeStamp),
@@ -11,7 +12,7 @@ TimeStamp::TimeStamp(std::uint64_t a_timeStamp, const std::string& a_format) :
 
 std::uint64_t TimeStamp::GenerateTimeStamp(std::tm a_time)
 {
-	return string::to_num<std::uint64_t>(std::format("{:03}{:02}{:02}{:02}{:02}", a_time.tm_year, a_time.tm_mon, a_time.tm_mday, a_time.tm_hour, a_time.tm_min));
+	return TimeStampKey::Generate(a_time);
 }
 
 std::string TimeStamp::GetMonthName(std::uint32_t a_month)
@@ -85,19 +86,7 @@ std::string TimeStamp::GetOrdinalSuffix(std::uint32_t a_day)
 
 std::tm TimeStamp::ExtractTimeStamp(std::uint64_t a_timeStamp)
 {
-	std::tm time{};
-
-	time.tm_min = a_timeStamp % 100;
-	a_timeStamp /= 100;
-	time.tm_hour = a_timeStamp % 100;
-	a_timeStamp /= 100;
-	time.tm_mday = a_timeStamp % 100;
-	a_timeStamp /= 100;
-	time.tm_mon = a_timeStamp % 100;
-	a_timeStamp /= 100;
-	time.tm_year = static_cast<int>(a_timeStamp);
-
-	return time;
+	return TimeStampKey::Extract(a_timeStamp);
 }
 
 std::string TimeStamp::GetFormattedYearMonthDay(std::uint32_t a_year, std::uint32_t a_month, std::uint32_t a_day)
@@ -176,11 +165,8 @@ void Speech::Initialize(RE::TESObjectREFR* a_speaker)
 		}
 		if (cellOrLoc) {
 			loc.SetNumericID(cellOrLoc->GetFormID());
-			locName = cellOrLoc->GetName();
-		}
-		if (locName.empty()) {
-			locName = "$DH_UnknownLocation"_T;
 		}
+		locName = NPCNameProvider::GetSingleton()->GetLocationName(cellOrLoc);
 	}
 }
 
@@ -231,6 +217,7 @@ void Dialogue::Draw()
 		refreshContents = false;
 		nameWidth = std::max(ImGui::CalcTextSize(playerName.c_str()).x, ImGui::CalcTextSize(speakerName.c_str()).x);
 		colonWidth = ImGui::CalcTextSize(":").x;
+		clipper.Clear();
 	}
 
 	bool isGlobalHistoryOpen = MANAGER(GlobalHistory)->IsGlobalHistoryOpen();
@@ -248,49 +235,63 @@ void Dialogue::Draw()
 				timeAndLoc = std::format("{} - {}", TimeStampToString(MANAGER(GlobalHistory)->Use12HourFormat()), locName);
 			}
 			ImGui::CenteredText(timeAndLoc.c_str(), false);
+			if (std::ranges::any_of(dialogue, [](const auto& line) { return !line.voice.empty(); })) {
+				const auto label = "$DH_ReplayConversation_Button"_T;
+				ImGui::AlignForWidth(ImGui::CalcTextSize(label).x + ImGui::GetStyle().FramePadding.x * 2);
+				if (ImGui::SmallButton(label)) {
+					MANAGER(Voice)->PlayConversation(*this);
+				}
+			}
 			ImGui::Spacing(4);
 		}
 
-		auto childSize = ImGui::GetContentRegionAvail();
-
-		ImGui::PushStyleColor(ImGuiCol_ChildBg, ImVec4());
-
-		if (ImGui::BeginTable("##DialogueLogs", 3, ImGuiTableFlags_ScrollY)) {
-			ImGui::TableSetupColumn("##Name", ImGuiTableColumnFlags_WidthFixed, nameWidth);
-			ImGui::TableSetupColumn("##Colon", ImGuiTableColumnFlags_WidthFixed, colonWidth);
-			ImGui::TableSetupColumn("##Line", ImGuiTableColumnFlags_WidthStretch);
-
-			for (auto& line : dialogue) {
-				auto speakerColor = line.isPlayer ? GetUserStyleColorVec4(USER_STYLE::kPlayerName) : GetUserStyleColorVec4(USER_STYLE::kSpeakerName);
-
-				ImGui::TableNextRow();
-				ImGui::TableSetColumnIndex(0);
-				{
-					ImGui::TextColored(speakerColor, line.name.c_str());
+		if (ImGui::BeginLog("##DialogueLogs")) {
+			const ImGui::LogRowLayout layout{ 0.0f, nameWidth, colonWidth };
+
+			const auto with_alpha = [](ImVec4 a_color, float a_alpha) {
+				a_color.w = a_alpha;
+				return ImGui::GetColorU32(a_color);
+			};
+
+			const auto playerNameColor = ImGui::GetColorU32(GetUserStyleColorVec4(USER_STYLE::kPlayerName));
+			const auto speakerNameColor = ImGui::GetColorU32(GetUserStyleColorVec4(USER_STYLE::kSpeakerName));
+			const auto playerLineColor = with_alpha(GetUserStyleColorVec4(USER_STYLE::kPlayerLine), 1.0f);
+			const auto speakerLineColor = with_alpha(GetUserStyleColorVec4(USER_STYLE::kSpeakerLine), isGlobalHistoryOpen ? GetUserStyleVar(USER_STYLE::kDisabledTextAlpha) : 1.0f);
+			const auto hoveredLineColor = with_alpha(GetUserStyleColorVec4(USER_STYLE::kSpeakerLine), 1.0f);
+
+			const auto [first, last] = clipper.Begin(layout, dialogue.size(), [&](std::size_t a_index) { return dialogue[a_index].line.c_str(); });
+			for (auto i = first; i < last; i++) {
+				auto& line = dialogue[i];
+
+				const ImGui::LogRowData row{
+					nullptr,
+					line.name.c_str(),
+					line.line.c_str(),
+					line.isPlayer ? playerNameColor : speakerNameColor,
+					line.isPlayer ? playerLineColor : speakerLineColor,
+					line.isPlayer ? playerLineColor : hoveredLineColor
+				};
+
+				if (!ImGui::LogRow(&line, layout, row, clipper.GetRowHeight(i))) {
+					line.hovered = false;
+					continue;
 				}
-				ImGui::TableSetColumnIndex(1);
-				{
-					ImGui::TextColored(speakerColor, ":");
-				}
-				ImGui::TableSetColumnIndex(2);
-				{
-					auto lineColor = line.isPlayer ? GetUserStyleColorVec4(USER_STYLE::kPlayerLine) : GetUserStyleColorVec4(USER_STYLE::kSpeakerLine);
-					lineColor.w = (!isGlobalHistoryOpen || line.isPlayer || line.hovered) ? 1.0f : GetUserStyleVar(USER_STYLE::kDisabledTextAlpha);
-
-					ImGui::TextColoredWrapped(lineColor, line.line.c_str());
 
-					line.hovered = ImGui::IsItemHovered();
+				line.hovered = ImGui::IsItemHovered();
 
-					if (ImGui::IsItemSelected() && isGlobalHistoryOpen) {
-						MANAGER(GlobalHistory)->PlayVoiceline(line.voice);
+				if (isGlobalHistoryOpen) {
+					if (line.hovered) {
+						MANAGER(Voice)->Prefetch(line.voice);
+					}
+					if (ImGui::IsItemSelected()) {
+						MANAGER(Voice)->Play(line.voice);
 					}
 				}
-				ImGui::Spacing(3);
 			}
-			ImGui::EndTable();
-		}
+			clipper.End();
 
-		ImGui::PopStyleColor();
+			ImGui::EndLog();
+		}
 	}
 	ImGui::Unindent();
 }
@@ -328,63 +329,67 @@ void Monologues::Draw()
 		nameWidth = 0.0f;
 		timeWidth = ImGui::CalcTextSize(MANAGER(GlobalHistory)->Use12HourFormat() ? "88:88 AM" : "88:88").x;
 
-		std::set<std::string> names{};
 		for (auto& monologue : monologues) {
-			if (names.insert(monologue.speakerName).second) {
-				if (auto width = ImGui::CalcTextSize(monologue.speakerName.c_str()).x; width > nameWidth) {
-					nameWidth = width;
-				}
+			if (auto width = ImGui::CalcTextSize(monologue.speakerName.c_str()).x; width > nameWidth) {
+				nameWidth = width;
 			}
-		};
+		}
 
 		colonWidth = ImGui::CalcTextSize(":").x;
+		clipper.Clear();
 	}
 
-	ImGui::PushStyleColor(ImGuiCol_ChildBg, ImVec4());
+	if (ImGui::BeginLog("##Logs")) {
+		const ImGui::LogRowLayout layout{ timeWidth, nameWidth, colonWidth };
 
-	if (ImGui::BeginTable("##Logs", 4, ImGuiTableFlags_ScrollY)) {
-		ImGui::TableSetupColumn("##Time", ImGuiTableColumnFlags_WidthFixed, timeWidth);
-		ImGui::TableSetupColumn("##Name", ImGuiTableColumnFlags_WidthFixed, nameWidth);
-		ImGui::TableSetupColumn("##Colon", ImGuiTableColumnFlags_WidthFixed, colonWidth);
-		ImGui::TableSetupColumn("##Line", ImGuiTableColumnFlags_WidthStretch);
+		const auto with_alpha = [](ImVec4 a_color, float a_alpha) {
+			a_color.w = a_alpha;
+			return ImGui::GetColorU32(a_color);
+		};
 
-		auto speakerColor = ImGui::GetUserStyleColorVec4(ImGui::USER_STYLE::kSpeakerName);
+		const auto speakerColor = ImGui::GetColorU32(ImGui::GetUserStyleColorVec4(ImGui::USER_STYLE::kSpeakerName));
+		const auto speakerLineColor = with_alpha(ImGui::GetUserStyleColorVec4(ImGui::USER_STYLE::kSpeakerLine), ImGui::GetUserStyleVar(ImGui::USER_STYLE::kDisabledTextAlpha));
+		const auto hoveredLineColor = with_alpha(ImGui::GetUserStyleColorVec4(ImGui::USER_STYLE::kSpeakerLine), 1.0f);
 
-		for (auto& monologue : monologues | std::views::reverse) {
-			ImGui::TableNextRow();
-			ImGui::TableSetColumnIndex(0);
-			{
-				if (monologue.hourMinTimeStamp.empty()) {
-					auto tm = monologue.ExtractTimeStamp();
-					monologue.hourMinTimeStamp = TimeStamp::GetFormattedHourMin(tm.tm_hour, tm.tm_min, MANAGER(GlobalHistory)->Use12HourFormat());
-				}
-				ImGui::Text(monologue.hourMinTimeStamp.c_str());
+		// newest first
+		const auto count = monologues.size();
+		const auto [first, last] = clipper.Begin(layout, count, [&](std::size_t a_index) { return monologues[count - 1 - a_index].line.line.c_str(); });
+		for (auto i = first; i < last; i++) {
+			auto& monologue = monologues[count - 1 - i];
+
+			if (monologue.hourMinTimeStamp.empty()) {
+				auto tm = monologue.ExtractTimeStamp();
+				monologue.hourMinTimeStamp = TimeStamp::GetFormattedHourMin(tm.tm_hour, tm.tm_min, MANAGER(GlobalHistory)->Use12HourFormat());
 			}
+
 			auto& [response, voice, hovered] = monologue.line;
-			ImGui::TableSetColumnIndex(1);
-			{
-				ImGui::TextColored(speakerColor, monologue.speakerName.c_str());
+
+			const ImGui::LogRowData row{
+				monologue.hourMinTimeStamp.c_str(),
+				monologue.speakerName.c_str(),
+				response.c_str(),
+				speakerColor,
+				speakerLineColor,
+				hoveredLineColor
+			};
+
+			if (!ImGui::LogRow(&monologue, layout, row, clipper.GetRowHeight(i))) {
+				hovered = false;
+				continue;
 			}
-			ImGui::TableSetColumnIndex(2);
-			{
-				ImGui::TextColored(speakerColor, ":");
+
+			hovered = ImGui::IsItemHovered();
+			if (hovered) {
+				MANAGER(Voice)->Prefetch(voice);
 			}
-			ImGui::TableSetColumnIndex(3);
-			{
-				auto lineColor = GetUserStyleColorVec4(ImGui::USER_STYLE::kSpeakerLine);
-				lineColor.w = hovered ? 1.0f : GetUserStyleVar(ImGui::USER_STYLE::kDisabledTextAlpha);
-				ImGui::TextColoredWrapped(lineColor, response.c_str());
-				hovered = ImGui::IsItemHovered();
-				if (ImGui::IsItemSelected()) {
-					MANAGER(GlobalHistory)->PlayVoiceline(voice);
-				}
+			if (ImGui::IsItemSelected()) {
+				MANAGER(Voice)->Play(voice);
 			}
-			ImGui::Spacing(3);
 		}
-		ImGui::EndTable();
-	}
+		clipper.End();
 
-	ImGui::PopStyleColor();
+		ImGui::EndLog();
+	}
 }
 
 void Monologues::RefreshContents()
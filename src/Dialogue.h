@@ -2,6 +2,7 @@
 
 #include "ImGui/IconsFonts.h"
 #include "ImGui/Util.h"
+#include "TimeStampKey.h"
 
 template <>
 struct glz::meta<RE::BGSNumericIDIndex>
@@ -145,6 +146,7 @@ struct Dialogue : public Speech
 	bool                        refreshContents{ true };
 	float                       nameWidth{ 0.0f };
 	float                       colonWidth{ 0.0f };
+	ImGui::LogClipper           clipper{};
 
 	struct glaze
 	{
@@ -205,4 +207,5 @@ struct Monologues
 	float                  timeWidth{ 0.0f };
 	float                  nameWidth{ 0.0f };
 	float                  colonWidth{ 0.0f };
+	ImGui::LogClipper      clipper{};
 };
@@ -1,298 +1,18 @@
 #include "GlobalHistory.h"
 
+#include "Capture.h"
 #include "Hooks.h"
 #include "Hotkeys.h"
 #include "ImGui/IconsFonts.h"
 #include "ImGui/Renderer.h"
 #include "ImGui/Styles.h"
 #include "ImGui/Util.h"
-#include "NPCNameProvider.h"
+#include "MemoryReport.h"
+#include "Profiler.h"
+#include "Voice.h"
 
 namespace GlobalHistory
 {
-	void DialogueHistory::RefreshTimeStamps(bool a_use12HourFormat)
-	{
-		if (dateMap.empty()) {
-			return;
-		}
-
-		for (auto& [dayMonth, hourMinMap] : dateMap.map) {
-			for (auto it = hourMinMap.begin(); it != hourMinMap.end(); it++) {
-				it->second.timeAndLoc.clear();
-
-				auto node = hourMinMap.extract(it);
-				node.key().SwitchHourFormat(a_use12HourFormat);
-				hourMinMap.insert(std::move(node));
-			}
-		}
-	}
-
-	void DialogueHistory::DrawDateTree()
-	{
-		DrawTreeImpl(dateMap);
-	}
-
-	void DialogueHistory::DrawLocationTree()
-	{
-		DrawTreeImpl(locationMap);
-	}
-
-	void DialogueHistory::SaveHistory(const std::tm& a_tm, const Dialogue& a_history, bool a_use12HourFormat)
-	{
-		history.push_back(a_history);
-
-		TimeStamp date;
-		date.FromYearMonthDay(a_tm.tm_year, a_tm.tm_mon, a_tm.tm_mday);
-
-		TimeStamp hourMin;
-		hourMin.FromHourMin(a_tm.tm_hour, a_tm.tm_min, a_history.speakerName, a_use12HourFormat);
-
-		dateMap.map[date][hourMin] = a_history;
-
-		TimeStamp speaker(a_history.timeStamp, a_history.speakerName);
-		locationMap.map[a_history.locName][speaker] = a_history;
-	}
-
-	void DialogueHistory::SaveHistoryToFile(const std::string& a_save)
-	{
-		BaseHistory::SaveHistoryToFileImpl(history, a_save);
-	}
-
-	bool DialogueHistory::LoadHistoryFromFile(const std::string& a_save)
-	{
-		return BaseHistory::LoadHistoryFromFileImpl(history, a_save);
-	}
-
-	std::optional<std::filesystem::path> DialogueHistory::GetDirectory()
-	{
-		if (!directory) {
-			directory = GetDirectoryImpl();
-		}
-		return directory;
-	}
-
-	void DialogueHistory::InitHistory()
-	{
-		std::string playerName = RE::PlayerCharacter::GetSingleton()->GetDisplayFullName();
-
-		if (!history.empty()) {
-			std::erase_if(history, [&](auto& dialogue) {
-				auto speakerActor = RE::TESForm::LookupByID<RE::Actor>(dialogue.id.GetNumericID());
-				if (!speakerActor) {
-					return true;
-				}
-
-				if (auto cellOrLoc = RE::TESForm::LookupByID(dialogue.loc.GetNumericID())) {
-					dialogue.locName = cellOrLoc->GetName();
-					if (dialogue.locName.empty()) {
-						dialogue.locName = "$DH_UnknownLocation"_T;
-					}
-				} else {
-					dialogue.locName = "???";
-				}
-
-				dialogue.speakerName = NPCNameProvider::GetSingleton()->GetName(speakerActor);
-				dialogue.playerName = playerName;
-
-				for (auto& line : dialogue.dialogue) {
-					line.isPlayer = line.voice.empty();
-					line.name = !line.isPlayer ? dialogue.speakerName : playerName;
-					if (line.line.empty() || line.line == " ") {
-						line.line = "...";
-					}
-					line.hovered = false;
-				}
-
-				auto time = dialogue.ExtractTimeStamp();
-
-				TimeStamp date;
-				date.FromYearMonthDay(time.tm_year, time.tm_mon, time.tm_mday);
-
-				TimeStamp hourMin;
-				hourMin.FromHourMin(time.tm_hour, time.tm_min, dialogue.speakerName, MANAGER(GlobalHistory)->Use12HourFormat());
-
-				TimeStamp speaker(dialogue.timeStamp, dialogue.speakerName);
-
-				dateMap.map[date][hourMin] = dialogue;
-				locationMap.map[dialogue.locName][speaker] = dialogue;
-
-				return false;
-			});
-		}
-	}
-
-	void ConversationHistory::RefreshTimeStamps()
-	{
-		if (dateMap.empty()) {
-			return;
-		}
-
-		for (auto& [dayMonth, monologues] : dateMap.map) {
-			for (auto it = monologues.monologues.begin(); it != monologues.monologues.end(); it++) {
-				it->hourMinTimeStamp.clear();
-			}
-		}
-	}
-
-	void ConversationHistory::DrawDateTree()
-	{
-		DrawTreeImpl(dateMap);
-	}
-
-	void ConversationHistory::DrawLocationTree()
-	{
-		DrawTreeImpl(locationMap);
-	}
-
-	void ConversationHistory::ClearCurrentHistory()
-	{
-		BaseHistory::ClearCurrentHistory();
-		currentFixedHistory = std::nullopt;
-	}
-
-	void ConversationHistory::SetCurrentHistory(const Monologues& a_history)
-	{
-		BaseHistory::SetCurrentHistory(a_history);
-
-		currentFixedHistory = a_history;
-		currentFixedHistory->RefreshContents();
-	}
-
-	void ConversationHistory::RefreshCurrentHistory()
-	{
-		currentHistory = currentFixedHistory;
-		if (currentHistory) {
-			if (!nameFilter.empty()) {
-				std::erase_if(currentHistory->monologues, [&](const auto& monologue) {
-					return !string::icontains(monologue.speakerName, nameFilter);
-				});
-			}
-			currentHistory->RefreshContents();
-		}
-	}
-
-	void ConversationHistory::RevertCurrentHistory()
-	{
-		currentHistory = currentFixedHistory;
-		if (currentHistory) {
-			currentHistory->RefreshContents();
-		}
-	}
-
-	void ConversationHistory::SaveHistory(const std::tm& a_tm, const Monologue& a_history)
-	{
-		history.monologues.push_back(a_history);
-
-		if (MANAGER(GlobalHistory)->IsGlobalHistoryOpen() && CanShowDialogue(a_history.dialogueType)) {
-			TimeStamp date;
-			date.FromYearMonthDay(a_tm.tm_year, a_tm.tm_mon, a_tm.tm_mday);
-
-			dateMap.map[date].monologues.push_back(a_history);
-			locationMap.map[a_history.locName][date].monologues.push_back(a_history);
-			if (currentFixedHistory) {
-				currentFixedHistory->monologues.push_back(a_history);
-				RefreshCurrentHistory();
-			}
-		}
-	}
-
-	void ConversationHistory::SaveHistoryToFile(const std::string& a_save)
-	{
-		BaseHistory::SaveHistoryToFileImpl(history.monologues, a_save);
-	}
-
-	bool ConversationHistory::LoadHistoryFromFile(const std::string& a_save)
-	{
-		return BaseHistory::LoadHistoryFromFileImpl(history.monologues, a_save);
-	}
-
-	std::optional<std::filesystem::path> ConversationHistory::GetDirectory()
-	{
-		if (!directory) {
-			directory = GetDirectoryImpl();
-		}
-		return directory;
-	}
-
-	void ConversationHistory::InitHistory()
-	{
-		if (!history.empty()) {
-			std::erase_if(history.monologues, [&](auto& monologue) {
-				auto speakerActor = RE::TESForm::LookupByID<RE::Actor>(monologue.id.GetNumericID());
-				if (!speakerActor) {
-					return true;
-				}
-
-				if (auto cellOrLoc = RE::TESForm::LookupByID(monologue.loc.GetNumericID())) {
-					monologue.locName = cellOrLoc->GetName();
-					if (monologue.locName.empty()) {
-						monologue.locName = "$DH_UnknownLocation"_T;
-					}
-				} else {
-					monologue.locName = "???";
-				}
-
-				monologue.speakerName = NPCNameProvider::GetSingleton()->GetName(speakerActor);
-
-				if (auto topic = RE::TESForm::LookupByID<RE::TESTopic>(monologue.topic.GetNumericID())) {
-					monologue.dialogueType = topic->data.type.underlying();
-				}
-
-				auto& line = monologue.line;
-				if (line.line.empty() || line.line == " ") {
-					line.line = "...";
-				}
-				line.hovered = false;
-
-				return false;
-			});
-		}
-	}
-
-	void ConversationHistory::LoadMCMSettings(const CSimpleIniA& a_ini)
-	{
-		showScene = a_ini.GetBoolValue("Settings", "bSceneDialogueConversationHistory", showMisc);
-		showCombat = a_ini.GetBoolValue("Settings", "bCombatDialogueConversationHistory", showCombat);
-		showFavor = a_ini.GetBoolValue("Settings", "bFavorDialogueConversationHistory", showFavor);
-		showDetection = a_ini.GetBoolValue("Settings", "bDetectionDialogueConversationHistory", showDetection);
-		showMisc = a_ini.GetBoolValue("Settings", "bMiscDialogueConversationHistory", showMisc);
-	}
-
-	bool ConversationHistory::CanShowDialogue(std::int32_t a_dialogueType) const
-	{
-		switch (a_dialogueType) {
-		case RE::DIALOGUE_TYPE::kSceneDialogue:
-			return showScene;
-		case RE::DIALOGUE_TYPE::kCombat:
-			return showCombat;
-		case RE::DIALOGUE_TYPE::kFavors:
-			return showFavor;
-		case RE::DIALOGUE_TYPE::kDetection:
-			return showDetection;
-		case RE::DIALOGUE_TYPE::kMiscellaneous:
-			return showMisc;
-		default:
-			return true;
-		}
-	}
-
-	void ConversationHistory::RefreshHistoryMaps()
-	{
-		dateMap.clear();
-		locationMap.clear();
-		for (auto& monologue : history.monologues) {
-			auto time = monologue.ExtractTimeStamp();
-
-			TimeStamp date;
-			date.FromYearMonthDay(time.tm_year, time.tm_mon, time.tm_mday);
-
-			if (CanShowDialogue(monologue.dialogueType)) {
-				dateMap.map[date].monologues.push_back(monologue);
-				locationMap.map[monologue.locName][date].monologues.push_back(monologue);
-			}
-		}
-	}
-
 	void Manager::Register()
 	{
 		RE::ScriptEventSourceHolder::GetSingleton()->AddEventSink<RE::TESLoadGameEvent>(this);
@@ -305,6 +25,8 @@ namespace GlobalHistory
 
 	void Manager::LoadMCMSettings(const CSimpleIniA& a_ini)
 	{
+		const auto last12HourFormat = use12HourFormat;
+
 		use12HourFormat = a_ini.GetBoolValue("Settings", "b12HourFormat", use12HourFormat);
 		unpauseMenu = a_ini.GetBoolValue("Settings", "bUnpauseGlobalHistory", unpauseMenu);
 		blurMenu = a_ini.GetBoolValue("Settings", "bBlurGlobalHistory", blurMenu);
@@ -312,8 +34,11 @@ namespace GlobalHistory
 
 		conversationHistory.LoadMCMSettings(a_ini);
 
-		dialogueHistory.RefreshTimeStamps(use12HourFormat);
-		conversationHistory.RefreshTimeStamps();
+		// re-keys every node, only needed when the format changes
+		if (use12HourFormat != last12HourFormat) {
+			dialogueHistory.RefreshTimeStamps(use12HourFormat);
+			conversationHistory.RefreshTimeStamps();
+		}
 	}
 
 	bool Manager::IsValid() const
@@ -350,6 +75,8 @@ namespace GlobalHistory
 			return;
 		}
 
+		MANAGER(Voice)->Update();
+
 		ImGui::SetNextWindowPos(ImGui::GetNativeViewportPos());
 		ImGui::SetNextWindowSize(ImGui::GetNativeViewportSize());
 
@@ -539,6 +266,8 @@ namespace GlobalHistory
 		menuOpenedJustNow = a_open;
 
 		if (a_open) {
+			MANAGER(Capture)->Drain();
+
 			ImGui::Styles::GetSingleton()->RefreshStyle();
 
 			if (blurMenu) {
@@ -556,6 +285,8 @@ namespace GlobalHistory
 			RE::PlaySound("UIMenuOK");
 
 		} else {
+			MANAGER(Voice)->Reset();
+
 			dialogueHistory.ClearCurrentHistory();
 			conversationHistory.ClearCurrentHistory();
 
@@ -565,8 +296,6 @@ namespace GlobalHistory
 			nameFilter.clear();
 			lastNameFilter.clear();
 
-			voiceHandle.Stop();
-
 			if (blurMenu) {
 				RE::UIBlurManager::GetSingleton()->DecrementBlurCount();
 			}
@@ -624,30 +353,65 @@ namespace GlobalHistory
 		dialogueHistory.SaveHistory(a_time, a_dialogue, use12HourFormat);
 	}
 
-	void Manager::AddConversation(const RE::TESObjectREFRPtr& a_speaker, RE::TESTopicInfo* a_info)
+	void Manager::AddConversations(std::span<const Capture::TopicEnd> a_topics)
 	{
-		if (!a_speaker || !a_info) {
+		const auto player = RE::PlayerCharacter::GetSingleton();
+		if (a_topics.empty() || !player) {
 			return;
 		}
 
-		if (a_speaker->IsPlayerRef() || a_speaker->GetDistance(RE::PlayerCharacter::GetSingleton()) > "fTalkingDistance:LOD"_ini.value() || RE::MenuTopicManager::GetSingleton()->speaker.get() == a_speaker) {
-			return;
-		}
+		// shared by every line in the batch
+		const auto playerPos = player->GetPosition();
+		const auto playerCell = player->GetParentCell();
+		const auto playerWorldspace = player->GetWorldspace();
+		const auto playerDisabled = player->IsDisabled();
+		const auto maxDistance = "fTalkingDistance:LOD"_ini.value();
+		const auto menuSpeaker = RE::MenuTopicManager::GetSingleton()->speaker.get();
 
-		auto dialogueItem = a_info->GetDialogueData(a_speaker.get());
-		if (auto currentResponse = !dialogueItem.responses.empty() ? dialogueItem.responses.front() : nullptr) {
-			if (!currentResponse->text.empty() && currentResponse->text != " ") {
-				auto time = RE::Calendar::GetSingleton()->GetTime();
+		topicInfoCache.clear();
 
-				std::string text = currentResponse->text.c_str();
-				std::string voice = currentResponse->voice.c_str();
-				if (!voice.empty()) {
-					// Strip "Data\"
-					voice.erase(0, 5);
-				}
+		// lines reported more than once this frame were dropped by the drain
+		for (const auto& topic : a_topics) {
+			const auto speaker = RE::TESForm::LookupByID<RE::TESObjectREFR>(topic.speaker);
+			if (!speaker || speaker->IsPlayerRef() || speaker == menuSpeaker) {
+				continue;
+			}
+
+			// GetDistance rules (disabled refs and other worldspaces are out of range), plus a same-cell check for interiors,
+			// which have no worldspace, so positions in another interior cell aren't compared with the player's
+			if (playerDisabled || speaker->IsDisabled() || speaker->GetWorldspace() != playerWorldspace) {
+				continue;
+			}
+			if (playerCell && playerCell->IsInteriorCell() && speaker->GetParentCell() != playerCell) {
+				continue;
+			}
+			if (speaker->GetPosition().GetSquaredDistance(playerPos) > maxDistance * maxDistance) {
+				continue;
+			}
+
+			auto [it, inserted] = topicInfoCache.try_emplace(topic.topicInfo, nullptr);
+			if (inserted) {
+				it->second = RE::TESForm::LookupByID<RE::TESTopicInfo>(topic.topicInfo);
+			}
+			if (!it->second) {
+				continue;
+			}
+
+			auto dialogueItem = it->second->GetDialogueData(speaker);
+			if (auto currentResponse = !dialogueItem.responses.empty() ? dialogueItem.responses.front() : nullptr) {
+				if (!currentResponse->text.empty() && currentResponse->text != " ") {
+					auto time = topic.time;
+
+					std::string text = currentResponse->text.c_str();
+					std::string voice = currentResponse->voice.c_str();
+					if (!voice.empty()) {
+						// Strip "Data\"
+						voice.erase(0, 5);
+					}
 
-				Monologue monologue(time, a_speaker.get(), text, voice, dialogueItem.topic);
-				conversationHistory.SaveHistory(time, monologue);
+					Monologue monologue(time, speaker, text, voice, dialogueItem.topic);
+					conversationHistory.SaveHistory(time, monologue);
+				}
 			}
 		}
 	}
@@ -655,8 +419,13 @@ namespace GlobalHistory
 	EventResult Manager::ProcessEvent(const RE::TESLoadGameEvent* a_evn, RE::BSTEventSource<RE::TESLoadGameEvent>*)
 	{
 		if (a_evn && finishLoading) {
+			Profiler::TraceSpan span("InitHistory");
+
 			dialogueHistory.InitHistory();
 			conversationHistory.InitHistory();
+			RevalidateNames();
+
+			MemoryReport::Log("Load");
 		}
 
 		return EventResult::kContinue;
@@ -665,7 +434,8 @@ namespace GlobalHistory
 	EventResult Manager::ProcessEvent(const RE::TESTopicInfoEvent* a_evn, RE::BSTEventSource<RE::TESTopicInfoEvent>*)
 	{
 		if (a_evn && a_evn->type == RE::TESTopicInfoEvent::TopicInfoEventType::kTopicEnd) {
-			AddConversation(a_evn->speakerRef, RE::TESForm::LookupByID<RE::TESTopicInfo>(a_evn->topicInfoFormID));
+			Capture::Record record{ .type = Capture::TYPE::kTopicEnd, .speaker = a_evn->speakerRef ? a_evn->speakerRef->GetFormID() : 0, .topicInfo = a_evn->topicInfoFormID };
+			MANAGER(Capture)->Push(record);
 		}
 
 		return EventResult::kContinue;
@@ -682,12 +452,24 @@ namespace GlobalHistory
 
 	void Manager::SaveFiles(const std::string& a_save)
 	{
+		Profiler::TraceSpan span("SaveFiles");
+
+		MANAGER(Capture)->Drain();
+		MANAGER(Capture)->RecordEvent(Capture::Session::EVENT::kSave);
+
 		dialogueHistory.SaveHistoryToFile(a_save);
 		conversationHistory.SaveHistoryToFile(a_save);
+
+		MANAGER(Capture)->LogLatency();
+		MemoryReport::Log("Save");
 	}
 
 	void Manager::LoadFiles(const std::string& a_save)
 	{
+		Profiler::TraceSpan span("LoadFiles");
+
+		namesGeneration++;
+
 		finishLoading |= dialogueHistory.LoadHistoryFromFile(a_save);
 		finishLoading |= conversationHistory.LoadHistoryFromFile(a_save);
 	}
@@ -720,32 +502,78 @@ namespace GlobalHistory
 
 	void Manager::Clear()
 	{
+		namesGeneration++;
+
 		dialogueHistory.Clear();
 		conversationHistory.Clear();
 	}
 
-	void Manager::PlayVoiceline(const std::string& a_voiceline)
+	void Manager::RevalidateNames()
 	{
-#undef GetObject
+		dialogueHistory.names.BeginRevalidation();
+		conversationHistory.names.BeginRevalidation();
 
-		if (a_voiceline.empty()) {
-			return;
-		}
+		QueueRevalidation(++namesGeneration);
+	}
 
-		if (voiceHandle.IsPlaying()) {
-			voiceHandle.FadeOutAndRelease(500);
-		}
+	void Manager::ReportMemory(MemoryReport::Report& a_report)
+	{
+		const auto report_history = [&](auto& a_history, const auto& a_entries) {
+			const std::string_view type = a_history.GetType();
 
-		RE::BSResource::ID file;
-		file.GenerateFromPath(a_voiceline.c_str());
+			a_report.Add(std::format("{}::history", type), a_entries);
+			a_report.Add(std::format("{}::dateMap", type), a_history.dateMap.map);
+			a_report.Add(std::format("{}::dateMap (filtered)", type), a_history.dateMap.filteredMap);
+			a_report.Add(std::format("{}::locationMap", type), a_history.locationMap.map);
+			a_report.Add(std::format("{}::locationMap (filtered)", type), a_history.locationMap.filteredMap);
+			a_report.Add(std::format("{}::currentHistory", type), a_history.currentHistory);
 
-		RE::BSAudioManager::GetSingleton()->BuildSoundDataFromFile(voiceHandle, file, 128 | 0x10, 128);
+			const auto& names = a_history.names;
 
-		auto soundOutput = RE::BGSDefaultObjectManager::GetSingleton()->GetObject<RE::BGSSoundOutput>(RE::DEFAULT_OBJECTS::kDialogueOutputModel2D);
-		if (soundOutput) {
-			voiceHandle.SetOutputModel(soundOutput);
-		}
+			auto namesUsage = MemoryReport::Measure(names.speakers);
+			namesUsage += MemoryReport::Measure(names.locations);
+			namesUsage += MemoryReport::Measure(names.topics);
+			namesUsage += MemoryReport::Measure(names.pending);
+			a_report.Add(std::format("{}::names", type), namesUsage);
+		};
 
-		voiceHandle.Play();
+		report_history(dialogueHistory, dialogueHistory.history);
+		report_history(conversationHistory, conversationHistory.history.monologues);
+
+		a_report.Add("ConversationHistory::currentFixedHistory", conversationHistory.currentFixedHistory);
+		a_report.Add("Manager::topicInfoCache", topicInfoCache);
+	}
+
+	// spread over frames, trusted names only need rebuilding if something changed since the save
+	void Manager::QueueRevalidation(std::uint32_t a_generation)
+	{
+		SKSE::GetTaskInterface()->AddTask([this, a_generation]() {
+			if (a_generation != namesGeneration) {
+				return;
+			}
+
+			constexpr std::size_t batchSize = 16;
+			if (!dialogueHistory.names.Revalidate(batchSize) || !conversationHistory.names.Revalidate(batchSize)) {
+				QueueRevalidation(a_generation);
+				return;
+			}
+
+			if (dialogueHistory.names.stale) {
+				logger::info("{} : Saved names are out of date, resolving again", dialogueHistory.GetType());
+				dialogueHistory.Clear();
+				dialogueHistory.InitHistory();
+				if (IsGlobalHistoryOpen()) {
+					dialogueHistory.RefreshCurrentHistory();
+				}
+			}
+			if (conversationHistory.names.stale) {
+				logger::info("{} : Saved names are out of date, resolving again", conversationHistory.GetType());
+				conversationHistory.Clear();
+				conversationHistory.InitHistory();
+				if (IsGlobalHistoryOpen()) {
+					conversationHistory.RefreshHistoryMaps();
+				}
+			}
+		});
 	}
 }
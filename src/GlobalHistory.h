@@ -1,6 +1,14 @@
 #pragma once
 
+#include "Capture.h"
 #include "Dialogue.h"
+#include "HistoryFilter.h"
+#include "Profiler.h"
+
+namespace MemoryReport
+{
+	class Report;
+}
 
 namespace GlobalHistory
 {
@@ -45,39 +53,14 @@ namespace GlobalHistory
 				return filteredMap;
 			}
 
+			Profiler::TraceSpan span("FilterHistory");
+
 			cachedFilter = nameFilter;
 			filteredMap = map;
 
-			if constexpr (std::is_same_v<T, MonologueDate>) {
-				std::erase_if(filteredMap, [](auto& item) {
-					auto& [root, monologueVec] = item;
-					std::erase_if(monologueVec.monologues, [&](const auto& monologue) {
-						return !string::icontains(monologue.speakerName, nameFilter);
-					});
-					return monologueVec.empty();
-				});
-			} else if constexpr (std::is_same_v<T, MonologueLocation>) {
-				std::erase_if(filteredMap, [](auto& item) {
-					auto& [root, monologueMap] = item;
-					std::erase_if(monologueMap, [&](auto& item) {
-						auto& [timeStamp, monologueVec] = item;
-						std::erase_if(monologueVec.monologues, [&](const auto& monologue) {
-							return !string::icontains(monologue.speakerName, nameFilter);
-						});
-						return monologueVec.empty();
-					});
-					return monologueMap.empty();
-				});
-			} else {
-				std::erase_if(filteredMap, [](auto& item) {
-					auto& [root, dialogueMap] = item;
-					std::erase_if(dialogueMap, [&](auto& item) {
-						const auto& [timeStamp, dialogue] = item;
-						return !string::icontains(dialogue.speakerName, nameFilter);
-					});
-					return dialogueMap.empty();
-				});
-			}
+			FilterHistory(filteredMap, [](const std::string& a_speakerName) {
+				return string::icontains(a_speakerName, nameFilter);
+			});
 
 			return filteredMap;
 		}
@@ -100,6 +83,95 @@ namespace GlobalHistory
 		std::string cachedFilter{};
 	};
 
+	// resolved names saved with the history, trusted on load while the load order is unchanged
+	struct NameSnapshot
+	{
+		enum class TYPE : std::uint8_t
+		{
+			kSpeaker,
+			kLocation,
+			kTopic
+		};
+
+		static std::uint64_t GetLoadOrderFingerprint();
+
+		template <class T>
+		static NameSnapshot Create(const std::vector<T>& a_history);
+
+		bool IsTrusted() const;
+
+		std::optional<std::string>  FindSpeaker(RE::FormID a_formID) const;
+		std::optional<std::string>  FindLocation(RE::FormID a_formID) const;
+		std::optional<std::int32_t> FindTopic(RE::FormID a_formID) const;
+
+		// re-resolves a few names per call on the main thread, returns true once done
+		void BeginRevalidation();
+		bool Revalidate(std::size_t a_count);
+
+		// members
+		std::uint64_t                      loadOrder{ 0 };
+		std::map<RE::FormID, std::string>  speakers{};
+		std::map<RE::FormID, std::string>  locations{};
+		std::map<RE::FormID, std::int32_t> topics{};
+
+		std::vector<std::pair<TYPE, RE::FormID>> pending{};  // skip write
+		bool                                     stale{ false };
+
+		struct glaze
+		{
+			using T = NameSnapshot;
+			static constexpr auto value = glz::object(
+				"loadOrder", &T::loadOrder,
+				"speakers", &T::speakers,
+				"locations", &T::locations,
+				"topics", &T::topics);
+		};
+	};
+
+	template <class T>
+	struct HistoryFile
+	{
+		// members
+		NameSnapshot names{};
+		T            history{};
+
+		struct glaze
+		{
+			using V = HistoryFile;
+			static constexpr auto value = glz::object(
+				"names", &V::names,
+				"history", &V::history);
+		};
+	};
+
+	template <class T>
+	inline NameSnapshot NameSnapshot::Create(const std::vector<T>& a_history)
+	{
+		NameSnapshot snapshot;
+		snapshot.loadOrder = GetLoadOrderFingerprint();
+
+		// newest entries win. Speakers the game can't resolve to an actor aren't saved, they'd never revalidate
+		for (const auto& entry : a_history) {
+			if (const auto id = entry.id.GetNumericID(); id != 0 && !entry.speakerName.empty()) {
+				if (const auto it = snapshot.speakers.find(id); it != snapshot.speakers.end()) {
+					it->second = entry.speakerName;
+				} else if (RE::TESForm::LookupByID<RE::Actor>(id)) {
+					snapshot.speakers.emplace(id, entry.speakerName);
+				}
+			}
+			if (const auto loc = entry.loc.GetNumericID(); loc != 0 && !entry.locName.empty()) {
+				snapshot.locations.insert_or_assign(loc, entry.locName);
+			}
+			if constexpr (std::is_same_v<T, Monologue>) {
+				if (const auto topic = entry.topic.GetNumericID(); topic != 0 && entry.dialogueType >= 0) {
+					snapshot.topics.insert_or_assign(topic, entry.dialogueType);
+				}
+			}
+		}
+
+		return snapshot;
+	}
+
 	template <class HistoryData, class DateMap, class LocationMap>
 	struct BaseHistory
 	{
@@ -131,6 +203,8 @@ namespace GlobalHistory
 			currentHistory->RefreshContents();
 		};
 		virtual const char*                          GetType() { return nullptr; }
+		virtual const char*                          GetLoadSpan() { return nullptr; }  // trace span names, string literals
+		virtual const char*                          GetSaveSpan() { return nullptr; }
 		virtual std::optional<std::filesystem::path> GetDirectory() { return std::nullopt; };
 		std::optional<std::filesystem::path>         GetFile(const std::string& a_save)
 		{
@@ -180,6 +254,7 @@ namespace GlobalHistory
 		{
 			dateMap.clear();
 			locationMap.clear();
+			names = {};
 		}
 		void ClearFilters()
 		{
@@ -192,6 +267,7 @@ namespace GlobalHistory
 		DialogueMap<LocationMap>             locationMap{};  // Dragonsreach -> Lydia
 		std::optional<HistoryData>           currentHistory{ std::nullopt };
 		std::optional<std::filesystem::path> directory;
+		NameSnapshot                         names{};
 
 	protected:
 		template <class T>
@@ -212,6 +288,8 @@ namespace GlobalHistory
 		void        DrawDateTree() override;
 		void        DrawLocationTree() override;
 		const char* GetType() override { return "DialogueHistory"; }
+		const char* GetLoadSpan() override { return "DialogueHistory::Load"; }
+		const char* GetSaveSpan() override { return "DialogueHistory::Save"; }
 		void        SaveHistory(const std::tm& a_tm, const Dialogue& a_history, bool a_use12HourFormat);
 		void        SaveHistoryToFile(const std::string& a_save);
 		bool        LoadHistoryFromFile(const std::string& a_save);
@@ -219,6 +297,7 @@ namespace GlobalHistory
 		std::optional<std::filesystem::path> GetDirectory() override;
 
 		void InitHistory();
+		void RefreshCurrentHistory();  // after InitHistory, the open entry is a copy with the old names
 
 		//members
 		std::vector<Dialogue> history{};
@@ -246,6 +325,8 @@ namespace GlobalHistory
 		void RevertCurrentHistory();
 
 		const char* GetType() override { return "ConversationHistory"; }
+		const char* GetLoadSpan() override { return "ConversationHistory::Load"; }
+		const char* GetSaveSpan() override { return "ConversationHistory::Save"; }
 
 		void SaveHistory(const std::tm& a_tm, const Monologue& a_history);
 		void SaveHistoryToFile(const std::string& a_save);
@@ -305,16 +386,24 @@ namespace GlobalHistory
 		void CleanupSavedFiles();
 		void Clear();
 
-		void PlayVoiceline(const std::string& a_voiceline);
+		void RevalidateNames();
 
-	private:
-		void AddConversation(const RE::TESObjectREFRPtr& a_speaker, RE::TESTopicInfo* a_info);
+		void ReportMemory(MemoryReport::Report& a_report);
+
+		// kTopicEnd events collected over a frame
+		void AddConversations(std::span<const Capture::TopicEnd> a_topics);
 
+	private:
 		EventResult ProcessEvent(const RE::TESLoadGameEvent* a_evn, RE::BSTEventSource<RE::TESLoadGameEvent>*) override;
 		EventResult ProcessEvent(const RE::TESTopicInfoEvent* a_evn, RE::BSTEventSource<RE::TESTopicInfoEvent>*) override;
 		EventResult ProcessEvent(const SKSE::ModCallbackEvent* a_evn, RE::BSTEventSource<SKSE::ModCallbackEvent>*) override;
 
+		void QueueRevalidation(std::uint32_t a_generation);
+
 		// members
+		Map<RE::FormID, RE::TESTopicInfo*> topicInfoCache;  // cleared per batch
+		std::uint32_t                      namesGeneration{ 0 };
+
 		bool                globalHistoryOpen{ false };
 		bool                menuOpenedJustNow{ false };
 		bool                openFromTweenMenu{ false };
@@ -322,7 +411,6 @@ namespace GlobalHistory
 		DialogueHistory     dialogueHistory;
 		ConversationHistory conversationHistory;
 		bool                drawConversation{ false };
-		RE::BSSoundHandle   voiceHandle{};
 		bool                finishLoading{ false };
 		bool                sortByLocation{ false };
 		bool                use12HourFormat{ false };
@@ -357,14 +445,31 @@ namespace GlobalHistory
 			return false;
 		}
 
+		Profiler::TraceSpan span(GetLoadSpan());
+
 		Clear();
 
 		logger::info("Loading {} file : {}", GetType(), jsonPath->string());
 
 		std::error_code err;
 		if (std::filesystem::exists(*jsonPath, err)) {
-			std::string buffer;
-			auto        ec = glz::read_file_json(a_history, jsonPath->string(), buffer);
+			std::ifstream file(*jsonPath, std::ios::binary);
+			std::string   buffer{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+			const auto ec = [&]() {
+				// files written before name snapshots are a bare array
+				if (const auto pos = buffer.find_first_not_of(" \t\r\n"); pos != std::string::npos && buffer[pos] == '[') {
+					return glz::read_json(a_history, buffer);
+				}
+
+				HistoryFile<std::remove_cvref_t<T>> historyFile{};
+				auto                                result = glz::read_json(historyFile, buffer);
+				if (!result) {
+					names = std::move(historyFile.names);
+					a_history = std::move(historyFile.history);
+				}
+				return result;
+			}();
 			if (ec) {
 				logger::info("\tFailed to read {} file (error: {})", GetType(), glz::format_error(ec, buffer));
 			}
@@ -384,10 +489,16 @@ namespace GlobalHistory
 			return;
 		}
 
+		Profiler::TraceSpan span(GetSaveSpan());
+
 		logger::info("Saving {} file : {}", GetType(), jsonPath->string());
 
+		HistoryFile<std::remove_cvref_t<T>> historyFile{ NameSnapshot::Create(a_history), std::move(a_history) };
+
 		std::string buffer;
-		auto        ec = glz::write_file_json(a_history, jsonPath->string(), buffer);
+		auto        ec = glz::write_file_json(historyFile, jsonPath->string(), buffer);
+
+		a_history = std::move(historyFile.history);
 
 		if (ec) {
 			logger::info("\tFailed to save {} file: (error: {})", GetType(), glz::format_error(ec, buffer));
@@ -0,0 +1,422 @@
+#include "GlobalHistory.h"
+
+#include "NPCNameProvider.h"
+#include "Profiler.h"
+
+namespace GlobalHistory
+{
+	std::uint64_t NameSnapshot::GetLoadOrderFingerprint()
+	{
+		// the plugin list can't change once data is loaded
+		static const auto fingerprint = [] {
+			std::string loadOrder;
+			if (const auto dataHandler = RE::TESDataHandler::GetSingleton()) {
+				for (const auto file : dataHandler->files) {
+					if (file) {
+						std::format_to(std::back_inserter(loadOrder), "{}:{:X}:{:X};", file->GetFilename(), file->compileIndex, file->smallFileCompileIndex);
+					}
+				}
+			}
+			return ankerl::unordered_dense::hash<std::string_view>{}(loadOrder);
+		}();
+
+		return fingerprint;
+	}
+
+	bool NameSnapshot::IsTrusted() const
+	{
+		return loadOrder != 0 && loadOrder == GetLoadOrderFingerprint();
+	}
+
+	std::optional<std::string> NameSnapshot::FindSpeaker(RE::FormID a_formID) const
+	{
+		if (const auto it = speakers.find(a_formID); it != speakers.end() && IsTrusted()) {
+			return it->second;
+		}
+		return std::nullopt;
+	}
+
+	std::optional<std::string> NameSnapshot::FindLocation(RE::FormID a_formID) const
+	{
+		if (const auto it = locations.find(a_formID); it != locations.end() && IsTrusted()) {
+			return it->second;
+		}
+		return std::nullopt;
+	}
+
+	std::optional<std::int32_t> NameSnapshot::FindTopic(RE::FormID a_formID) const
+	{
+		if (const auto it = topics.find(a_formID); it != topics.end() && IsTrusted()) {
+			return it->second;
+		}
+		return std::nullopt;
+	}
+
+	void NameSnapshot::BeginRevalidation()
+	{
+		pending.clear();
+		stale = false;
+
+		if (!IsTrusted()) {
+			return;
+		}
+
+		pending.reserve(speakers.size() + locations.size() + topics.size());
+		for (const auto& formID : speakers | std::views::keys) {
+			pending.emplace_back(TYPE::kSpeaker, formID);
+		}
+		for (const auto& formID : locations | std::views::keys) {
+			pending.emplace_back(TYPE::kLocation, formID);
+		}
+		for (const auto& formID : topics | std::views::keys) {
+			pending.emplace_back(TYPE::kTopic, formID);
+		}
+	}
+
+	bool NameSnapshot::Revalidate(std::size_t a_count)
+	{
+		const auto nameProvider = NPCNameProvider::GetSingleton();
+
+		for (; a_count > 0 && !pending.empty() && !stale; a_count--) {
+			const auto [type, formID] = pending.back();
+			pending.pop_back();
+
+			// a form that no longer exists only drops its own entry, the rest of the snapshot can still be trusted
+			switch (type) {
+			case TYPE::kSpeaker:
+				if (!RE::TESForm::LookupByID<RE::Actor>(formID)) {
+					speakers.erase(formID);
+				} else {
+					stale = nameProvider->GetName(formID) != speakers.at(formID);
+				}
+				break;
+			case TYPE::kLocation:
+				if (!RE::TESForm::LookupByID(formID)) {
+					locations.erase(formID);
+				} else {
+					stale = nameProvider->GetLocationName(formID) != locations.at(formID);
+				}
+				break;
+			case TYPE::kTopic:
+				if (const auto topic = RE::TESForm::LookupByID<RE::TESTopic>(formID); !topic) {
+					topics.erase(formID);
+				} else {
+					stale = topic->data.type.underlying() != topics.at(formID);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+
+		if (stale) {
+			pending.clear();
+		}
+
+		return pending.empty();
+	}
+
+	void DialogueHistory::RefreshTimeStamps(bool a_use12HourFormat)
+	{
+		if (dateMap.empty()) {
+			return;
+		}
+
+		Profiler::TraceSpan span("RefreshTimeStamps");
+
+		for (auto& [dayMonth, hourMinMap] : dateMap.map) {
+			for (auto it = hourMinMap.begin(); it != hourMinMap.end(); it++) {
+				it->second.timeAndLoc.clear();
+
+				auto node = hourMinMap.extract(it);
+				node.key().SwitchHourFormat(a_use12HourFormat);
+				hourMinMap.insert(std::move(node));
+			}
+		}
+	}
+
+	void DialogueHistory::DrawDateTree()
+	{
+		DrawTreeImpl(dateMap);
+	}
+
+	void DialogueHistory::DrawLocationTree()
+	{
+		DrawTreeImpl(locationMap);
+	}
+
+	void DialogueHistory::SaveHistory(const std::tm& a_tm, const Dialogue& a_history, bool a_use12HourFormat)
+	{
+		history.push_back(a_history);
+
+		TimeStamp date;
+		date.FromYearMonthDay(a_tm.tm_year, a_tm.tm_mon, a_tm.tm_mday);
+
+		TimeStamp hourMin;
+		hourMin.FromHourMin(a_tm.tm_hour, a_tm.tm_min, a_history.speakerName, a_use12HourFormat);
+
+		dateMap.map[date][hourMin] = a_history;
+
+		TimeStamp speaker(a_history.timeStamp, a_history.speakerName);
+		locationMap.map[a_history.locName][speaker] = a_history;
+	}
+
+	void DialogueHistory::SaveHistoryToFile(const std::string& a_save)
+	{
+		BaseHistory::SaveHistoryToFileImpl(history, a_save);
+	}
+
+	bool DialogueHistory::LoadHistoryFromFile(const std::string& a_save)
+	{
+		return BaseHistory::LoadHistoryFromFileImpl(history, a_save);
+	}
+
+	std::optional<std::filesystem::path> DialogueHistory::GetDirectory()
+	{
+		if (!directory) {
+			directory = GetDirectoryImpl();
+		}
+		return directory;
+	}
+
+	void DialogueHistory::InitHistory()
+	{
+		std::string playerName = RE::PlayerCharacter::GetSingleton()->GetDisplayFullName();
+
+		const auto nameProvider = NPCNameProvider::GetSingleton();
+
+		if (!history.empty()) {
+			std::erase_if(history, [&](auto& dialogue) {
+				auto speakerName = names.FindSpeaker(dialogue.id.GetNumericID());
+				if (!speakerName) {
+					speakerName = nameProvider->GetName(dialogue.id.GetNumericID());
+					if (!speakerName) {
+						return true;
+					}
+				}
+
+				if (auto locName = names.FindLocation(dialogue.loc.GetNumericID())) {
+					dialogue.locName = std::move(*locName);
+				} else {
+					dialogue.locName = nameProvider->GetLocationName(dialogue.loc.GetNumericID());
+				}
+				dialogue.speakerName = std::move(*speakerName);
+				dialogue.playerName = playerName;
+
+				for (auto& line : dialogue.dialogue) {
+					line.isPlayer = line.voice.empty();
+					line.name = !line.isPlayer ? dialogue.speakerName : playerName;
+					if (line.line.empty() || line.line == " ") {
+						line.line = "...";
+					}
+					line.hovered = false;
+				}
+
+				auto time = dialogue.ExtractTimeStamp();
+
+				TimeStamp date;
+				date.FromYearMonthDay(time.tm_year, time.tm_mon, time.tm_mday);
+
+				TimeStamp hourMin;
+				hourMin.FromHourMin(time.tm_hour, time.tm_min, dialogue.speakerName, MANAGER(GlobalHistory)->Use12HourFormat());
+
+				TimeStamp speaker(dialogue.timeStamp, dialogue.speakerName);
+
+				dateMap.map[date][hourMin] = dialogue;
+				locationMap.map[dialogue.locName][speaker] = dialogue;
+
+				return false;
+			});
+		}
+	}
+
+	void DialogueHistory::RefreshCurrentHistory()
+	{
+		if (!currentHistory) {
+			return;
+		}
+
+		if (const auto it = std::ranges::find(history, currentHistory->timeStamp, &Dialogue::timeStamp); it != history.end()) {
+			SetCurrentHistory(*it);
+		} else {
+			ClearCurrentHistory();
+		}
+	}
+
+	void ConversationHistory::RefreshTimeStamps()
+	{
+		if (dateMap.empty()) {
+			return;
+		}
+
+		for (auto& [dayMonth, monologues] : dateMap.map) {
+			for (auto it = monologues.monologues.begin(); it != monologues.monologues.end(); it++) {
+				it->hourMinTimeStamp.clear();
+			}
+		}
+	}
+
+	void ConversationHistory::DrawDateTree()
+	{
+		DrawTreeImpl(dateMap);
+	}
+
+	void ConversationHistory::DrawLocationTree()
+	{
+		DrawTreeImpl(locationMap);
+	}
+
+	void ConversationHistory::ClearCurrentHistory()
+	{
+		BaseHistory::ClearCurrentHistory();
+		currentFixedHistory = std::nullopt;
+	}
+
+	void ConversationHistory::SetCurrentHistory(const Monologues& a_history)
+	{
+		BaseHistory::SetCurrentHistory(a_history);
+
+		currentFixedHistory = a_history;
+		currentFixedHistory->RefreshContents();
+	}
+
+	void ConversationHistory::RefreshCurrentHistory()
+	{
+		currentHistory = currentFixedHistory;
+		if (currentHistory) {
+			if (!nameFilter.empty()) {
+				std::erase_if(currentHistory->monologues, [&](const auto& monologue) {
+					return !string::icontains(monologue.speakerName, nameFilter);
+				});
+			}
+			currentHistory->RefreshContents();
+		}
+	}
+
+	void ConversationHistory::RevertCurrentHistory()
+	{
+		currentHistory = currentFixedHistory;
+		if (currentHistory) {
+			currentHistory->RefreshContents();
+		}
+	}
+
+	void ConversationHistory::SaveHistory(const std::tm& a_tm, const Monologue& a_history)
+	{
+		history.monologues.push_back(a_history);
+
+		if (MANAGER(GlobalHistory)->IsGlobalHistoryOpen() && CanShowDialogue(a_history.dialogueType)) {
+			TimeStamp date;
+			date.FromYearMonthDay(a_tm.tm_year, a_tm.tm_mon, a_tm.tm_mday);
+
+			dateMap.map[date].monologues.push_back(a_history);
+			locationMap.map[a_history.locName][date].monologues.push_back(a_history);
+			if (currentFixedHistory) {
+				currentFixedHistory->monologues.push_back(a_history);
+				RefreshCurrentHistory();
+			}
+		}
+	}
+
+	void ConversationHistory::SaveHistoryToFile(const std::string& a_save)
+	{
+		BaseHistory::SaveHistoryToFileImpl(history.monologues, a_save);
+	}
+
+	bool ConversationHistory::LoadHistoryFromFile(const std::string& a_save)
+	{
+		return BaseHistory::LoadHistoryFromFileImpl(history.monologues, a_save);
+	}
+
+	std::optional<std::filesystem::path> ConversationHistory::GetDirectory()
+	{
+		if (!directory) {
+			directory = GetDirectoryImpl();
+		}
+		return directory;
+	}
+
+	void ConversationHistory::InitHistory()
+	{
+		const auto nameProvider = NPCNameProvider::GetSingleton();
+
+		if (!history.empty()) {
+			std::erase_if(history.monologues, [&](auto& monologue) {
+				auto speakerName = names.FindSpeaker(monologue.id.GetNumericID());
+				if (!speakerName) {
+					speakerName = nameProvider->GetName(monologue.id.GetNumericID());
+					if (!speakerName) {
+						return true;
+					}
+				}
+
+				if (auto locName = names.FindLocation(monologue.loc.GetNumericID())) {
+					monologue.locName = std::move(*locName);
+				} else {
+					monologue.locName = nameProvider->GetLocationName(monologue.loc.GetNumericID());
+				}
+				monologue.speakerName = std::move(*speakerName);
+
+				if (auto dialogueType = names.FindTopic(monologue.topic.GetNumericID())) {
+					monologue.dialogueType = *dialogueType;
+				} else if (auto topic = RE::TESForm::LookupByID<RE::TESTopic>(monologue.topic.GetNumericID())) {
+					monologue.dialogueType = topic->data.type.underlying();
+				}
+
+				auto& line = monologue.line;
+				if (line.line.empty() || line.line == " ") {
+					line.line = "...";
+				}
+				line.hovered = false;
+
+				return false;
+			});
+		}
+	}
+
+	void ConversationHistory::LoadMCMSettings(const CSimpleIniA& a_ini)
+	{
+		showScene = a_ini.GetBoolValue("Settings", "bSceneDialogueConversationHistory", showMisc);
+		showCombat = a_ini.GetBoolValue("Settings", "bCombatDialogueConversationHistory", showCombat);
+		showFavor = a_ini.GetBoolValue("Settings", "bFavorDialogueConversationHistory", showFavor);
+		showDetection = a_ini.GetBoolValue("Settings", "bDetectionDialogueConversationHistory", showDetection);
+		showMisc = a_ini.GetBoolValue("Settings", "bMiscDialogueConversationHistory", showMisc);
+	}
+
+	bool ConversationHistory::CanShowDialogue(std::int32_t a_dialogueType) const
+	{
+		switch (a_dialogueType) {
+		case RE::DIALOGUE_TYPE::kSceneDialogue:
+			return showScene;
+		case RE::DIALOGUE_TYPE::kCombat:
+			return showCombat;
+		case RE::DIALOGUE_TYPE::kFavors:
+			return showFavor;
+		case RE::DIALOGUE_TYPE::kDetection:
+			return showDetection;
+		case RE::DIALOGUE_TYPE::kMiscellaneous:
+			return showMisc;
+		default:
+			return true;
+		}
+	}
+
+	void ConversationHistory::RefreshHistoryMaps()
+	{
+		Profiler::TraceSpan span("RefreshHistoryMaps");
+
+		dateMap.clear();
+		locationMap.clear();
+		for (auto& monologue : history.monologues) {
+			auto time = monologue.ExtractTimeStamp();
+
+			TimeStamp date;
+			date.FromYearMonthDay(time.tm_year, time.tm_mon, time.tm_mday);
+
+			if (CanShowDialogue(monologue.dialogueType)) {
+				dateMap.map[date].monologues.push_back(monologue);
+				locationMap.map[monologue.locName][date].monologues.push_back(monologue);
+			}
+		}
+	}
+}
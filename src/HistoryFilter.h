@@ -0,0 +1,30 @@
+#pragma once
+
+namespace GlobalHistory
+{
+	// drops every entry whose speaker a_keep rejects, then any branch left empty.
+	// Same walk for the date and location layouts, nested maps end in a Dialogue or a Monologues list
+	template <class T, class F>
+	void FilterHistory(T& a_map, const F& a_keep)
+	{
+		// branches are filtered in place, erase_if predicates only get const access
+		for (auto it = a_map.begin(); it != a_map.end();) {
+			auto& leaf = it->second;
+
+			bool empty;
+			if constexpr (requires { leaf.monologues; }) {
+				std::erase_if(leaf.monologues, [&](const auto& a_monologue) {
+					return !a_keep(a_monologue.speakerName);
+				});
+				empty = leaf.monologues.empty();
+			} else if constexpr (requires { leaf.speakerName; }) {
+				empty = !a_keep(leaf.speakerName);
+			} else {
+				FilterHistory(leaf, a_keep);
+				empty = leaf.empty();
+			}
+
+			it = empty ? a_map.erase(it) : std::next(it);
+		}
+	}
+}
@@ -1,7 +1,10 @@
 #include "Hooks.h"
+#include "Capture.h"
 #include "GlobalHistory.h"
+#include "Hotkeys.h"
 #include "Input.h"
 #include "LocalHistory.h"
+#include "Profiler.h"
 
 namespace Hooks
 {
@@ -10,9 +13,13 @@ namespace Hooks
 		static void thunk(RE::BSTEventSource<RE::InputEvent*>* a_dispatcher, RE::InputEvent* const* a_events)
 		{
 			if (a_events) {
+				Profiler::ScopedTimer timer(Profiler::SECTION::kInput);
 				MANAGER(Input)->ProcessInputEvents(a_events);
 			}
 
+			// runs every frame, events or not, so holds fire on time
+			MANAGER(Hotkeys)->TryToggleDialogueHistory();
+
 			if (MANAGER(GlobalHistory)->IsGlobalHistoryOpen()) {
 				constexpr RE::InputEvent* const dummy[] = { nullptr };
 				func(a_dispatcher, dummy);
@@ -31,7 +38,9 @@ namespace Hooks
 
 			if (a_this && a_this->selectedResponseNode) {
 				if (auto dialogue = a_this->selectedResponseNode->item) {
-					MANAGER(LocalHistory)->AddDialogue(RE::PlayerCharacter::GetSingleton(), dialogue->topicText.c_str(), {});
+					Capture::Record record{ .type = Capture::TYPE::kPlayerLine };
+					record.SetText(dialogue->topicText.c_str());
+					MANAGER(Capture)->Push(record);
 				}
 			}
 		}
@@ -45,17 +54,14 @@ namespace Hooks
 			func(a_this, a_speaker, a_subtitle, a_alwaysDisplay);
 
 			if (a_speaker && !a_speaker->IsPlayerRef()) {
-				std::string subtitle = a_subtitle;
-				std::string voice;
+				Capture::Record record{ .type = Capture::TYPE::kSpeakerLine, .speaker = a_speaker->GetFormID() };
+				record.SetText(a_subtitle ? a_subtitle : "");
 				if (auto topic = RE::MenuTopicManager::GetSingleton()->lastSelectedDialogue) {
 					if (auto response = topic->currentResponse; response && response->item) {
-						if (voice = response->item->voice; !voice.empty()) {
-							// Strip "Data\"
-							voice.erase(0, 5);
-						}
+						record.SetVoice(response->item->voice.c_str());
 					}
 				}
-				MANAGER(LocalHistory)->AddDialogue(a_speaker, (subtitle.empty() || subtitle == " ") ? "..." : a_subtitle, voice);
+				MANAGER(Capture)->Push(record);
 			}
 		}
 		static inline REL::Relocation<decltype(thunk)> func;
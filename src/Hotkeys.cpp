@@ -9,32 +9,91 @@ namespace Hotkeys
 {
 	void Manager::LoadHotKeys(const CSimpleIniA& a_ini)
 	{
+		holdTime = static_cast<float>(a_ini.GetDoubleValue("Controls", "fHoldTime", holdTime));
+		doubleTapTime = static_cast<float>(a_ini.GetDoubleValue("Controls", "fDoubleTapTime", doubleTapTime));
+
 		localHistory.LoadKeys(a_ini);
 		globalHistory.LoadKeys(a_ini);
+
+		MANAGER(IconFont)->PrefetchIcons();
 	}
 
-	void Manager::TryToggleDialogueHistory(const RE::InputEvent* const* a_event)
+	// runs for every input batch, even while typing, so releases are never missed
+	void Manager::UpdateKeyState(std::span<const Input::Event> a_events)
 	{
-		localHistory.ProcessKeyPress(a_event, []() {
-			MANAGER(LocalHistory)->ToggleActive();
-		});
-		globalHistory.ProcessKeyPress(a_event, []() {
-			MANAGER(GlobalHistory)->ToggleActive();
-		});
+		for (const auto& event : a_events) {
+			if (event.type != Input::Event::TYPE::kButton) {
+				continue;
+			}
+			auto key = event.idCode;
+			switch (event.device) {
+			case RE::INPUT_DEVICE::kKeyboard:
+				break;
+			case RE::INPUT_DEVICE::kMouse:
+				key += SKSE::InputMap::kMacro_MouseButtonOffset;
+				break;
+			case RE::INPUT_DEVICE::kGamepad:
+				key = SKSE::InputMap::GamepadMaskToKeycode(key);
+				break;
+			default:
+				continue;
+			}
+			if (key < keyState.size()) {
+				keyState.set(key, event.IsPressed());
+			}
+		}
 	}
 
-	void Manager::KeyCombo::KeyComboImpl::LoadKeys(const CSimpleIniA& a_ini, std::string_view a_setting)
+	// releases are lost while the game window is unfocused
+	void Manager::ResetKeyState()
 	{
-		primary = a_ini.GetLongValue("Controls", a_setting.data(), primary);
-		modifier = a_ini.GetLongValue("Controls", std::format("{}Modifier", a_setting).c_str(), modifier);
+		keyState.reset();
+	}
 
-		keys.clear();
-		if (primary != -1) {
-			keys.insert(primary);
+	void Manager::TryToggleDialogueHistory()
+	{
+		if (const auto context = ImGui::GetCurrentContext(); !context || !context->IO.WantTextInput) {
+			const auto now = std::chrono::steady_clock::now();
+
+			localHistory.Update(keyState, now, holdTime, doubleTapTime, []() {
+				MANAGER(LocalHistory)->ToggleActive();
+			});
+			globalHistory.Update(keyState, now, holdTime, doubleTapTime, []() {
+				MANAGER(GlobalHistory)->ToggleActive();
+			});
 		}
-		if (modifier != -1) {
-			keys.insert(modifier);
+
+		// also while typing, or a scroll would stay down until the next one
+		ReleaseWheelKeys(keyState);
+	}
+
+	// iKey, iKeyModifier, iKeyModifier2...
+	void Manager::KeyCombo::LoadChord(Chord& a_chord, const CSimpleIniA& a_ini, std::string_view a_setting)
+	{
+		auto& values = a_chord.values;
+
+		for (std::size_t i = 0;; i++) {
+			std::string setting(a_setting);
+			if (i == 1) {
+				setting += "Modifier";
+			} else if (i > 1) {
+				setting += std::format("Modifier{}", i);
+			}
+
+			if (!a_ini.GetValue("Controls", setting.c_str())) {
+				if (i < values.size()) {
+					continue;
+				}
+				break;
+			}
+
+			if (i >= values.size()) {
+				values.resize(i + 1, -1);
+			}
+			values[i] = a_ini.GetLongValue("Controls", setting.c_str(), values[i]);
 		}
+
+		a_chord.UpdateKeys();
 	}
 
 	Manager::KeyCombo::KeyCombo(const std::string& a_type) :
@@ -43,8 +102,13 @@ namespace Hotkeys
 
 	void Manager::KeyCombo::LoadKeys(const CSimpleIniA& a_ini)
 	{
-		keyboard.LoadKeys(a_ini, std::format("i{}Key", type).c_str());
-		gamePad.LoadKeys(a_ini, std::format("i{}GamePad", type).c_str());
+		LoadChord(keyboard, a_ini, std::format("i{}Key", type));
+		LoadChord(gamePad, a_ini, std::format("i{}GamePad", type));
+
+		trigger.type = static_cast<TRIGGER>(a_ini.GetLongValue("Controls", std::format("i{}Trigger", type).c_str(), std::to_underlying(trigger.type)));
+		trigger.Reset();
+
+		iconsDevice.reset();
 	}
 
 	bool Manager::KeyCombo::IsInvalid() const
@@ -52,7 +116,7 @@ namespace Hotkeys
 		return keyboard.keys.empty() && gamePad.keys.empty();
 	}
 
-	std::set<std::uint32_t> Manager::KeyCombo::GetKeys() const
+	const std::set<std::uint32_t>& Manager::KeyCombo::GetKeys() const
 	{
 		switch (MANAGER(Input)->GetInputDevice()) {
 		case Input::DEVICE::kGamepadOrbis:
@@ -63,48 +127,28 @@ namespace Hotkeys
 		}
 	}
 
-	bool Manager::KeyCombo::ProcessKeyPress(const RE::InputEvent* const* a_event, std::function<void()> a_callback)
+	const std::set<const IconFont::IconTexture*>& Manager::KeyCombo::GetIcons()
 	{
-		std::set<std::uint32_t> pressed;
-
-		for (auto event = *a_event; event; event = event->next) {
-			const auto button = event->AsButtonEvent();
-			if (!button || !button->HasIDCode()) {
-				continue;
-			}
-			if (button->IsPressed()) {
-				auto key = button->GetIDCode();
-				switch (button->GetDevice()) {
-				case RE::INPUT_DEVICE::kKeyboard:
-					break;
-				case RE::INPUT_DEVICE::kMouse:
-					key += SKSE::InputMap::kMacro_MouseButtonOffset;
-					break;
-				case RE::INPUT_DEVICE::kGamepad:
-					key = SKSE::InputMap::GamepadMaskToKeycode(key);
-					break;
-				default:
-					continue;
-				}
-				pressed.insert(key);
-			}
+		if (const auto device = MANAGER(Input)->GetInputDevice(); iconsDevice != device) {
+			iconsDevice = device;
+			icons = MANAGER(IconFont)->GetIcons(GetKeys());
 		}
+		return icons;
+	}
 
-		if (!pressed.empty() && (pressed == keyboard.keys || pressed == gamePad.keys)) {
-			if (!triggered) {
-				triggered = true;
-				a_callback();
-			}
-		} else {
-			triggered = false;
+	// returns true if the callback ran
+	bool Manager::KeyCombo::Update(const KeyState& a_state, std::chrono::steady_clock::time_point a_now, float a_holdTime, float a_doubleTapTime, void (*a_callback)())
+	{
+		if (trigger.Update(keyboard.Matches(a_state) || gamePad.Matches(a_state), a_now, a_holdTime, a_doubleTapTime)) {
+			a_callback();
+			return true;
 		}
-
-		return triggered;
+		return false;
 	}
 
-	std::set<const IconFont::IconTexture*> Manager::LocalHistoryIcons() const
+	const std::set<const IconFont::IconTexture*>& Manager::LocalHistoryIcons()
 	{
-		return MANAGER(IconFont)->GetIcons(localHistory.GetKeys());
+		return localHistory.GetIcons();
 	}
 
 	std::uint32_t Manager::EscapeKey()
@@ -123,8 +167,8 @@ namespace Hotkeys
 		return MANAGER(IconFont)->GetIcon(EscapeKey());
 	}
 
-	std::set<const IconFont::IconTexture*> Manager::GlobalHistoryIcons() const
+	const std::set<const IconFont::IconTexture*>& Manager::GlobalHistoryIcons()
 	{
-		return MANAGER(IconFont)->GetIcons(globalHistory.GetKeys());
+		return globalHistory.GetIcons();
 	}
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Input.h"
+#include "KeyChord.h"
+
 namespace IconFont
 {
 	struct IconTexture;
@@ -12,13 +15,15 @@ namespace Hotkeys
 	public:
 		void LoadHotKeys(const CSimpleIniA& a_ini);
 
-		void TryToggleDialogueHistory(const RE::InputEvent* const* a_event);
+		void UpdateKeyState(std::span<const Input::Event> a_events);
+		void ResetKeyState();
+		void TryToggleDialogueHistory();  // every frame, hold timing doesn't depend on the game repeating button events
 
 		static std::uint32_t         EscapeKey();
 		const IconFont::IconTexture* EscapeIcon() const;
 
-		std::set<const IconFont::IconTexture*> GlobalHistoryIcons() const;
-		std::set<const IconFont::IconTexture*> LocalHistoryIcons() const;
+		const std::set<const IconFont::IconTexture*>& GlobalHistoryIcons();
+		const std::set<const IconFont::IconTexture*>& LocalHistoryIcons();
 
 	private:
 		struct KeyCombo
@@ -28,29 +33,33 @@ namespace Hotkeys
 
 			void LoadKeys(const CSimpleIniA& a_ini);
 
-			bool                    IsInvalid() const;
-			std::set<std::uint32_t> GetKeys() const;
+			bool                           IsInvalid() const;
+			const std::set<std::uint32_t>& GetKeys() const;
 
-			bool ProcessKeyPress(const RE::InputEvent* const* a_event, std::function<void()> a_callback);
+			// cached until the keys or input device change
+			const std::set<const IconFont::IconTexture*>& GetIcons();
 
-		private:
-			struct KeyComboImpl
-			{
-				void LoadKeys(const CSimpleIniA& a_ini, std::string_view a_setting);
+			bool Update(const KeyState& a_state, std::chrono::steady_clock::time_point a_now, float a_holdTime, float a_doubleTapTime, void (*a_callback)());
 
-				std::int32_t primary{ -1 };
-				std::int32_t modifier{ -1 };
+		private:
+			static void LoadChord(Chord& a_chord, const CSimpleIniA& a_ini, std::string_view a_setting);
 
-				std::set<std::uint32_t> keys{};
-			};
+			Chord   keyboard;
+			Chord   gamePad;
+			Trigger trigger;
 
-			KeyComboImpl keyboard;
-			KeyComboImpl gamePad;
+			std::set<const IconFont::IconTexture*> icons{};
+			std::optional<Input::DEVICE>           iconsDevice{};
 
-			bool        triggered{ false };
-			std::string type;
+			std::string                            type;
 		};
 
+		// members
+		KeyState keyState{};
+
+		float holdTime{ 0.5f };
+		float doubleTapTime{ 0.3f };
+
 		KeyCombo localHistory{ "LocalHistory" };
 		KeyCombo globalHistory{ "GlobalHistory" };
 	};
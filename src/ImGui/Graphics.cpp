@@ -2,7 +2,7 @@
 
 namespace ImGui
 {
-	Texture::Texture(std::wstring_view a_textureFolder, std::wstring_view a_textureName) :
+	AtlasImage::AtlasImage(std::wstring_view a_textureFolder, std::wstring_view a_textureName) :
 		name(a_textureName)
 	{
 		path.append(a_textureFolder)
@@ -10,49 +10,211 @@ namespace ImGui
 			.append(L".png");
 	}
 
-	Texture::~Texture()
+	void WICDecoder::BeginThread()
 	{
-		if (srView) {
-			srView.Reset();
+		initialized = SUCCEEDED(CoInitializeEx(nullptr, COINIT_MULTITHREADED));
+	}
+
+	void WICDecoder::EndThread()
+	{
+		if (initialized) {
+			CoUninitialize();
 		}
 	}
 
-	bool Texture::Load()
+	std::int32_t WICDecoder::Decode(const std::filesystem::path& a_path, DecodedImage& a_image)
 	{
-		bool result = false;
+		DirectX::ScratchImage scratch;
 
-		auto image = std::make_shared<DirectX::ScratchImage>();
-		auto hr = DirectX::LoadFromWICFile(path.c_str(), DirectX::WIC_FLAGS_IGNORE_SRGB, nullptr, *image);
+		auto hr = DirectX::LoadFromWICFile(a_path.c_str(), DirectX::WIC_FLAGS_IGNORE_SRGB | DirectX::WIC_FLAGS_FORCE_RGB, nullptr, scratch);
+		if (FAILED(hr)) {
+			return hr;
+		}
 
-		if (SUCCEEDED(hr)) {
-			if (auto renderer = RE::BSGraphics::Renderer::GetSingleton()) {
-				ComPtr<ID3D11Resource> pTexture{};
-				ID3D11Device*          device = (ID3D11Device*)renderer->data.forwarder;
+		if (scratch.GetMetadata().format != DXGI_FORMAT_R8G8B8A8_UNORM) {
+			DirectX::ScratchImage converted;
+			hr = DirectX::Convert(*scratch.GetImage(0, 0, 0), DXGI_FORMAT_R8G8B8A8_UNORM, DirectX::TEX_FILTER_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, converted);
+			if (FAILED(hr)) {
+				return hr;
+			}
+			scratch = std::move(converted);
+		}
 
-				hr = DirectX::CreateTexture(device, image->GetImages(), 1, image->GetMetadata(), pTexture.GetAddressOf());
+		const auto* src = scratch.GetImage(0, 0, 0);
 
-				if (SUCCEEDED(hr)) {
-					D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc{};
-					srvDesc.Format = image->GetMetadata().format;
-					srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-					srvDesc.Texture2D.MipLevels = 1;
-					srvDesc.Texture2D.MostDetailedMip = 0;
+		a_image.width = static_cast<std::uint32_t>(src->width);
+		a_image.height = static_cast<std::uint32_t>(src->height);
+		a_image.pixels.resize(static_cast<std::size_t>(a_image.GetRowPitch()) * a_image.height);
 
-					hr = device->CreateShaderResourceView(pTexture.Get(), &srvDesc, srView.GetAddressOf());
-					result = SUCCEEDED(hr);
-				}
+		for (std::uint32_t y = 0; y < a_image.height; y++) {
+			std::memcpy(a_image.pixels.data() + static_cast<std::size_t>(y) * a_image.GetRowPitch(), src->pixels + y * src->rowPitch, a_image.GetRowPitch());
+		}
 
-				size.x = static_cast<float>(image->GetMetadata().width);
-				size.y = static_cast<float>(image->GetMetadata().height);
+		return 0;
+	}
+
+	void TextureAtlas::DecodeImages(IImageDecoder& a_decoder, std::span<AtlasImage* const> a_images)
+	{
+		std::vector<std::filesystem::path> paths;
+		paths.reserve(a_images.size());
+		for (const auto& image : a_images) {
+			paths.emplace_back(image->path);
+		}
 
-				pTexture.Reset();
+		std::vector<DecodedImage> decoded(a_images.size());
+		const auto                results = DecodeParallel(a_decoder, paths, decoded);
+
+		for (std::size_t i = 0; i < a_images.size(); i++) {
+			auto& image = a_images[i];
+			if (results[i] != 0) {
+				logger::error("Failed to decode {} (0x{:X}), using a placeholder", stl::utf16_to_utf8(image->path).value_or(""s), static_cast<std::uint32_t>(results[i]));
+				decoded[i] = MakePlaceholder();
 			}
+			image->image = std::move(decoded[i]);
+			image->imageSize = ImVec2(static_cast<float>(image->image.width), static_cast<float>(image->image.height));
 		}
+	}
 
-		if (image) {
-			image.reset();
+	// images already in the atlas keep their place
+	bool TextureAtlas::Add(std::span<AtlasImage* const> a_images)
+	{
+		std::vector<AtlasImage*>       newImages;
+		std::vector<ShelfPacker::Size> sizes;
+		newImages.reserve(a_images.size());
+		sizes.reserve(a_images.size());
+
+		for (auto& image : a_images) {
+			if (!image->image.empty() && !image->srView) {
+				newImages.push_back(image);
+				sizes.push_back({ image->image.width, image->image.height });
+			}
+		}
+
+		if (newImages.empty()) {
+			return false;
+		}
+
+		const auto rects = packer.InsertBatch(sizes);
+
+		std::size_t idx = 0;
+		std::erase_if(newImages, [&](auto& image) {
+			const auto& rect = rects[idx++];
+			if (!rect) {
+				logger::error("Icon atlas is full ({}x{}), skipping {}", packer.GetWidth(), packer.GetHeight(), stl::utf16_to_utf8(image->name).value_or(""s));
+				image->image = {};
+				return true;
+			}
+			image->pos = ImVec2(static_cast<float>(rect->x), static_cast<float>(rect->y));
+			return false;
+		});
+
+		if (newImages.empty()) {
+			return false;
+		}
+
+		const auto renderer = RE::BSGraphics::Renderer::GetSingleton();
+		if (!renderer) {
+			return false;
 		}
 
-		return result;
+		const auto context = (ID3D11DeviceContext*)renderer->data.context;
+
+		// rounded up, so a few more icons don't recreate the texture each time
+		const auto width = packer.GetWidth();
+		const auto height = std::min<std::uint32_t>(std::bit_ceil(packer.GetHeight()), D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION);
+
+		if (!texture || width > size.x || height > size.y) {
+			if (!Resize((ID3D11Device*)renderer->data.forwarder, context, width, height)) {
+				for (auto& image : newImages) {
+					image->image = {};
+				}
+				return false;
+			}
+		}
+
+		for (auto& image : newImages) {
+			const auto& src = image->image;
+
+			D3D11_BOX box{};
+			box.left = static_cast<UINT>(image->pos.x);
+			box.top = static_cast<UINT>(image->pos.y);
+			box.front = 0;
+			box.right = box.left + src.width;
+			box.bottom = box.top + src.height;
+			box.back = 1;
+
+			context->UpdateSubresource(texture.Get(), 0, &box, src.pixels.data(), src.GetRowPitch(), 0);
+
+			image->image = {};
+			images.push_back(image);
+		}
+
+		UpdateUVs();
+
+		return true;
+	}
+
+	// new texture with the old contents copied to the same spot, the padding stays transparent
+	bool TextureAtlas::Resize(ID3D11Device* a_device, ID3D11DeviceContext* a_context, std::uint32_t a_width, std::uint32_t a_height)
+	{
+		D3D11_TEXTURE2D_DESC desc{};
+		desc.Width = a_width;
+		desc.Height = a_height;
+		desc.MipLevels = 1;
+		desc.ArraySize = 1;
+		desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+		const std::vector<std::uint8_t> pixels(static_cast<std::size_t>(a_width) * a_height * 4, 0);
+
+		D3D11_SUBRESOURCE_DATA data{};
+		data.pSysMem = pixels.data();
+		data.SysMemPitch = a_width * 4;
+
+		ComPtr<ID3D11Texture2D> newTexture{};
+		auto                    hr = a_device->CreateTexture2D(&desc, &data, newTexture.GetAddressOf());
+		if (FAILED(hr)) {
+			logger::error("Failed to create {}x{} icon atlas (0x{:X})", a_width, a_height, static_cast<std::uint32_t>(hr));
+			return false;
+		}
+
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc{};
+		srvDesc.Format = desc.Format;
+		srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+		srvDesc.Texture2D.MipLevels = 1;
+		srvDesc.Texture2D.MostDetailedMip = 0;
+
+		ComPtr<ID3D11ShaderResourceView> newSRView{};
+		hr = a_device->CreateShaderResourceView(newTexture.Get(), &srvDesc, newSRView.GetAddressOf());
+		if (FAILED(hr)) {
+			return false;
+		}
+
+		if (texture) {
+			D3D11_BOX box{};
+			box.right = static_cast<UINT>(size.x);
+			box.bottom = static_cast<UINT>(size.y);
+			box.back = 1;
+			a_context->CopySubresourceRegion(newTexture.Get(), 0, 0, 0, 0, texture.Get(), 0, &box);
+		}
+
+		texture = std::move(newTexture);
+		srView = std::move(newSRView);
+
+		size.x = static_cast<float>(a_width);
+		size.y = static_cast<float>(a_height);
+
+		return true;
+	}
+
+	void TextureAtlas::UpdateUVs()
+	{
+		for (auto& image : images) {
+			image->srView = srView.Get();
+			image->uv0 = image->pos / size;
+			image->uv1 = (image->pos + image->imageSize) / size;
+		}
 	}
 }
@@ -1,19 +1,58 @@
 #pragma once
 
+#include "ImGui/ImageDecoder.h"
+#include "ImGui/ShelfPacker.h"
+
 namespace ImGui
 {
-	struct Texture
+	// DirectXTex's WIC loader, COM is initialized on each worker thread
+	class WICDecoder : public IImageDecoder
 	{
-		Texture() = delete;
-		Texture(std::wstring_view a_textureFolder, std::wstring_view a_textureName);
-		~Texture();
+	public:
+		void         BeginThread() override;
+		void         EndThread() override;
+		std::int32_t Decode(const std::filesystem::path& a_path, DecodedImage& a_image) override;
 
-		bool Load();
+	private:
+		// members
+		static inline thread_local bool initialized{ false };  // by BeginThread, on this worker
+	};
+
+	// image packed into a TextureAtlas
+	struct AtlasImage
+	{
+		AtlasImage() = delete;
+		AtlasImage(std::wstring_view a_textureFolder, std::wstring_view a_textureName);
+		~AtlasImage() = default;
 
 		// members
-		std::wstring                     name{};
-		std::wstring                     path{};
+		std::wstring                           name{};
+		std::wstring                           path{};
+		DecodedImage              image{};            // freed once uploaded to the atlas
+		ID3D11ShaderResourceView* srView{ nullptr };  // owned by the atlas, set once packed
+		ImVec2                    imageSize{};
+		ImVec2                    pos{};  // in atlas pixels
+		ImVec2                    uv0{};
+		ImVec2                    uv1{};
+	};
+
+	struct TextureAtlas
+	{
+		static void DecodeImages(IImageDecoder& a_decoder, std::span<AtlasImage* const> a_images);  // placeholders for files that fail
+
+		bool Add(std::span<AtlasImage* const> a_images);
+
+		// members
+		ComPtr<ID3D11Texture2D>          texture{ nullptr };
 		ComPtr<ID3D11ShaderResourceView> srView{ nullptr };
 		ImVec2                           size{};
+		ShelfPacker                      packer{ D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION, padding };
+		std::vector<AtlasImage*>         images{};  // packed
+
+	private:
+		static constexpr std::uint32_t padding = 1;
+
+		bool Resize(ID3D11Device* a_device, ID3D11DeviceContext* a_context, std::uint32_t a_width, std::uint32_t a_height);
+		void UpdateUVs();
 	};
 }
@@ -1,26 +1,18 @@
 #include "IconsFonts.h"
 
+#include "Hotkeys.h"
 #include "ImGui/Styles.h"
 #include "Input.h"
+#include "MemoryReport.h"
+#include "Profiler.h"
 #include "Util.h"
 
 namespace IconFont
 {
 	IconTexture::IconTexture(std::wstring_view a_iconName) :
-		ImGui::Texture(LR"(Data/Interface/ImGuiIcons/Icons/)", a_iconName)
+		ImGui::AtlasImage(LR"(Data/Interface/ImGuiIcons/Icons/)", a_iconName)
 	{}
 
-	bool IconTexture::Load()
-	{
-		const bool result = ImGui::Texture::Load();
-
-		if (result) {
-			imageSize = size;
-		}
-
-		return result;
-	}
-
 	void IconTexture::Resize(float a_scale)
 	{
 		auto scale = a_scale / 1080;  // standard window height
@@ -38,14 +30,50 @@ namespace IconFont
 		spacing = static_cast<float>(a_ini.GetDoubleValue(a_section, "fSpacing", -1.5));
 	}
 
-	void Font::LoadFont(const ImVector<ImWchar>& a_ranges)
+	// reads the file if it was written after a_lastWriteTime
+	bool FontFile::Load(const std::string& a_path, std::filesystem::file_time_type a_lastWriteTime)
+	{
+		std::error_code ec;
+		const auto      writeTime = std::filesystem::last_write_time(a_path, ec);
+		if (ec) {
+			logger::error("Unable to find font file {} (error: {})", a_path, ec.message());
+			return false;
+		}
+
+		if (writeTime == a_lastWriteTime) {
+			return false;
+		}
+
+		std::ifstream file(a_path, std::ios::binary | std::ios::ate);
+		if (!file.good()) {
+			logger::error("Unable to read font file {}", a_path);
+			return false;
+		}
+
+		data.resize(static_cast<std::size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(data.data(), data.size());
+
+		lastWriteTime = writeTime;
+
+		return true;
+	}
+
+	// no glyph ranges, glyphs are baked on demand the first time they are drawn
+	void Font::LoadFont(FontFile& a_file)
 	{
 		const auto& io = ImGui::GetIO();
 
+		if (a_file.data.empty()) {
+			font = nullptr;
+			return;
+		}
+
 		ImFontConfig font_config;
 		font_config.GlyphExtraAdvanceX = spacing;
+		font_config.FontDataOwnedByAtlas = false;
 
-		font = io.Fonts->AddFontFromFileTTF(name.c_str(), size, &font_config, a_ranges.Data);
+		font = io.Fonts->AddFontFromMemoryTTF(a_file.data.data(), static_cast<int>(a_file.data.size()), size, &font_config);
 	}
 
 	void Manager::LoadSettings(CSimpleIniA& a_ini)
@@ -63,73 +91,158 @@ namespace IconFont
 		buttonScheme = static_cast<BUTTON_SCHEME>(a_ini.GetLongValue("Controls", "iButtonScheme", std::to_underlying(buttonScheme)));
 	}
 
-	void Manager::LoadIcons()
+	// icons for the current bindings and device are resolved on the next frame, before anything is drawn
+	void Manager::PrefetchIcons()
 	{
-		unknownKey.Load();
-		upKey.Load();
-		downKey.Load();
-		leftKey.Load();
-		rightKey.Load();
-
-		std::for_each(keyboard.begin(), keyboard.end(), [](auto& Icon) {
-			Icon.second.Load();
-		});
-		std::for_each(gamePad.begin(), gamePad.end(), [](auto& Icon) {
-			auto& [xbox, ps4] = Icon.second;
-			xbox.Load();
-			ps4.Load();
-		});
-		std::for_each(mouse.begin(), mouse.end(), [](auto& Icon) {
-			Icon.second.Load();
-		});
+		prefetchIcons.store(true);
+	}
+
+	// icons are only decoded once they are asked for, and added to the atlas at the start of the frame
+	void Manager::UpdateIcons()
+	{
+		if (prefetchIcons.exchange(false)) {
+			const auto hotkeys = MANAGER(Hotkeys);
+			hotkeys->LocalHistoryIcons();
+			hotkeys->GlobalHistoryIcons();
+			hotkeys->EscapeIcon();
+		}
+
+		if (requestedIcons.empty()) {
+			return;
+		}
+
+		Profiler::TraceSpan span("LoadIcons");
+
+		ImGui::WICDecoder decoder;
+		ImGui::TextureAtlas::DecodeImages(decoder, requestedIcons);
+
+		const auto lastSize = iconAtlas.size;
+		if (!iconAtlas.Add(requestedIcons)) {
+			logger::error("Failed to add {} icons to the atlas", requestedIcons.size());
+		}
+		requestedIcons.clear();
+
+		if (iconAtlas.size.x != lastSize.x || iconAtlas.size.y != lastSize.y) {
+			logger::info("Loaded {} icons ({}x{} atlas)", iconAtlas.images.size(), iconAtlas.size.x, iconAtlas.size.y);
+		}
+
+		ResizeIcons();
+	}
+
+	const IconTexture* Manager::RequestIcon(IconTexture* a_icon)
+	{
+		if (!a_icon->requested) {
+			a_icon->requested = true;
+			requestedIcons.push_back(a_icon);
+		}
+		return a_icon;
 	}
 
 	void Manager::ResizeIcons()
 	{
 		float buttonScale = ImGui::GetUserStyleVar(ImGui::USER_STYLE::kButtonScale);
 
-		unknownKey.Resize(buttonScale);
-		upKey.Resize(buttonScale);
-		downKey.Resize(buttonScale);
-		leftKey.Resize(buttonScale);
-		rightKey.Resize(buttonScale);
-
-		std::for_each(keyboard.begin(), keyboard.end(), [&](auto& Icon) {
-			Icon.second.Resize(buttonScale);
-		});
-		std::for_each(gamePad.begin(), gamePad.end(), [&](auto& Icon) {
-			auto& [xbox, ps4] = Icon.second;
-			xbox.Resize(buttonScale);
-			ps4.Resize(buttonScale);
-		});
-		std::for_each(mouse.begin(), mouse.end(), [&](auto& Icon) {
-			Icon.second.Resize(buttonScale);
+		ForEachIcon([&](auto& icon) {
+			icon.Resize(buttonScale);
 		});
 	}
 
+	std::uint64_t Manager::GetFontsKey()
+	{
+		std::string key;
+		for (const auto* font : { &headerFont, &buttonFont, &localHistoryFont, &globalHistoryFont }) {
+			const auto& file = fontFiles[font->name];
+			key += std::format("{}|{}|{}|{}|{};", font->name, file.lastWriteTime.time_since_epoch().count(), file.data.size(), font->size, font->spacing);
+		}
+
+		return ankerl::unordered_dense::hash<std::string_view>{}(key);
+	}
+
+	Manager::FontFiles Manager::LoadFontFiles(StringMap<std::filesystem::file_time_type> a_files)
+	{
+		std::vector<std::pair<std::string, std::future<std::optional<FontFile>>>> tasks;
+		tasks.reserve(a_files.size());
+
+		for (auto& [path, lastWriteTime] : a_files) {
+			tasks.emplace_back(path, std::async(std::launch::async, [path, lastWriteTime]() -> std::optional<FontFile> {
+				FontFile file;
+				if (file.Load(path, lastWriteTime)) {
+					return file;
+				}
+				return std::nullopt;
+			}));
+		}
+
+		FontFiles changedFiles;
+		for (auto& [path, task] : tasks) {
+			if (auto file = task.get()) {
+				changedFiles.emplace(path, std::move(*file));
+			}
+		}
+
+		return changedFiles;
+	}
+
+	// font files are read in the background, the current atlas stays in use until UpdateFonts swaps them in
 	void Manager::ReloadFonts()
 	{
 		if (loadFontsOnce && loadedFonts) {
 			return;
 		}
 
-		loadedFonts = true;
+		Profiler::TraceSpan span("ReloadFonts");
+
+		if (pendingFontFiles.valid()) {
+			return;
+		}
+
+		StringMap<std::filesystem::file_time_type> files;
+		for (const auto* font : { &headerFont, &buttonFont, &localHistoryFont, &globalHistoryFont }) {
+			const auto it = fontFiles.find(font->name);
+			files.emplace(font->name, it != fontFiles.end() && !it->second.data.empty() ? it->second.lastWriteTime : std::filesystem::file_time_type{});
+		}
+
+		pendingFontFiles = std::async(std::launch::async, LoadFontFiles, std::move(files));
+
+		// nothing to fall back to
+		if (!loadedFonts) {
+			pendingFontFiles.wait();
+			UpdateFonts();
+		}
+	}
+
+	void Manager::UpdateFonts()
+	{
+		using namespace std::chrono_literals;
+
+		if (!pendingFontFiles.valid() || pendingFontFiles.wait_for(0s) != std::future_status::ready) {
+			return;
+		}
+
+		auto changedFiles = pendingFontFiles.get();
+
+		// same files and sizes as the current atlas
+		if (loadedFonts && changedFiles.empty() && GetFontsKey() == fontsKey) {
+			return;
+		}
 
 		logger::info("Reloading fonts...");
 
 		auto& io = ImGui::GetIO();
 		io.Fonts->Clear();
 
-		ImVector<ImWchar> ranges;
+		// old buffers are no longer referenced by the atlas
+		for (auto& [path, file] : changedFiles) {
+			fontFiles.insert_or_assign(path, std::move(file));
+		}
 
-		ImFontGlyphRangesBuilder builder;
-		builder.AddText(RE::BSScaleformManager::GetSingleton()->validNameChars.c_str());
-		builder.BuildRanges(&ranges);
+		loadedFonts = true;
+		fontsKey = GetFontsKey();
 
-		headerFont.LoadFont(ranges);
-		buttonFont.LoadFont(ranges);
-		localHistoryFont.LoadFont(ranges);
-		globalHistoryFont.LoadFont(ranges);
+		headerFont.LoadFont(fontFiles[headerFont.name]);
+		buttonFont.LoadFont(fontFiles[buttonFont.name]);
+		localHistoryFont.LoadFont(fontFiles[localHistoryFont.name]);
+		globalHistoryFont.LoadFont(fontFiles[globalHistoryFont.name]);
 
 		io.Fonts->Build();
 
@@ -159,37 +272,74 @@ namespace IconFont
 		return { globalHistoryFont.font, globalHistoryFont.size };
 	}
 
+	std::vector<std::filesystem::path> Manager::GetFontPaths() const
+	{
+		std::vector<std::filesystem::path> paths;
+		for (const auto* font : { &headerFont, &buttonFont, &localHistoryFont, &globalHistoryFont }) {
+			if (std::ranges::find(paths, font->name) == paths.end()) {
+				paths.emplace_back(font->name);
+			}
+		}
+		return paths;
+	}
+
+	// textures are estimated from their RGBA8 dimensions
+	void Manager::ReportMemory(MemoryReport::Report& a_report)
+	{
+		MemoryReport::Usage decodedIcons;
+		ForEachIcon([&](auto& icon) {
+			if (!icon.image.empty()) {
+				decodedIcons.count++;
+				decodedIcons.bytes += icon.image.pixels.capacity();
+			}
+		});
+		a_report.Add("IconFont::icons (awaiting upload)", decodedIcons);
+
+		a_report.Add("IconFont::iconAtlas (texture)", { iconAtlas.srView ? 1u : 0u, static_cast<std::size_t>(iconAtlas.size.x * iconAtlas.size.y) * 4 });
+
+		MemoryReport::Usage files;
+		for (const auto& file : fontFiles | std::views::values) {
+			files.count++;
+			files.bytes += file.data.capacity();
+		}
+		a_report.Add("IconFont::fontFiles", files);
+
+		const auto fonts = ImGui::GetIO().Fonts;
+		const auto texData = fonts ? fonts->TexData : nullptr;
+		a_report.Add("IconFont::fontAtlas (texture)", { fonts ? static_cast<std::size_t>(fonts->Fonts.Size) : 0, texData ? static_cast<std::size_t>(texData->GetSizeInBytes()) : 0 });
+	}
+
 	const IconTexture* Manager::GetIcon(std::uint32_t key)
 	{
 		switch (key) {
 		case KEY::kUp:
 		case SKSE::InputMap::kGamepadButtonOffset_DPAD_UP:
-			return &upKey;
+			return RequestIcon(&upKey);
 		case KEY::kDown:
 		case SKSE::InputMap::kGamepadButtonOffset_DPAD_DOWN:
-			return &downKey;
+			return RequestIcon(&downKey);
 		case KEY::kLeft:
 		case SKSE::InputMap::kGamepadButtonOffset_DPAD_LEFT:
-			return &leftKey;
+			return RequestIcon(&leftKey);
 		case KEY::kRight:
 		case SKSE::InputMap::kGamepadButtonOffset_DPAD_RIGHT:
-			return &rightKey;
+			return RequestIcon(&rightKey);
 		default:
 			{
 				if (auto device = MANAGER(Input)->GetInputDevice(); device == Input::DEVICE::kGamepadDirectX || device == Input::DEVICE::kGamepadOrbis) {
 					if (const auto it = gamePad.find(key); it != gamePad.end()) {
-						return GetGamePadIcon(it->second);
+						return RequestIcon(GetGamePadIcon(it->second));
 					}
 				} else {
 					if (key >= SKSE::InputMap::kMacro_MouseButtonOffset) {
 						if (const auto it = mouse.find(key); it != mouse.end()) {
-							return &it->second;
+							return RequestIcon(&it->second);
 						}
 					} else if (const auto it = keyboard.find(static_cast<KEY>(key)); it != keyboard.end()) {
-						return &it->second;
+						return RequestIcon(&it->second);
 					}
 				}
-				return &unknownKey;
+				return RequestIcon(&unknownKey);
 			}
 		}
 	}
@@ -198,7 +348,7 @@ namespace IconFont
 	{
 		std::set<const IconTexture*> icons{};
 		if (keys.empty()) {
-			icons.insert(&unknownKey);
+			icons.insert(RequestIcon(&unknownKey));
 		} else {
 			for (auto& key : keys) {
 				icons.insert(GetIcon(key));
@@ -207,7 +357,7 @@ namespace IconFont
 		return icons;
 	}
 
-	const IconTexture* Manager::GetGamePadIcon(const GamepadIcon& a_icons) const
+	IconTexture* Manager::GetGamePadIcon(GamepadIcon& a_icons) const
 	{
 		switch (buttonScheme) {
 		case BUTTON_SCHEME::kAutoDetect:
@@ -231,7 +381,13 @@ namespace ImGui
 
 	ImVec2 ButtonIcon(const IconTexture* a_IconData)
 	{
-		ImGui::Image((std::uint64_t)a_IconData->srView.Get(), a_IconData->size);
+		// not packed until the next frame
+		if (!a_IconData->srView) {
+			ImGui::Dummy(a_IconData->size);
+			return a_IconData->size;
+		}
+
+		ImGui::Image((std::uint64_t)a_IconData->srView, a_IconData->size, a_IconData->uv0, a_IconData->uv1);
 		return a_IconData->size;
 	}
 
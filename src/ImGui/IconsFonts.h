@@ -2,19 +2,24 @@
 
 #include "ImGui/Graphics.h"
 
+namespace MemoryReport
+{
+	class Report;
+}
+
 namespace IconFont
 {
-	struct IconTexture : ImGui::Texture
+	struct IconTexture : ImGui::AtlasImage
 	{
 		IconTexture() = delete;
 		IconTexture(std::wstring_view a_iconName);
 		~IconTexture() = default;
 
-		bool Load();
 		void Resize(float a_scale);
 
 		// members
-		ImVec2 imageSize{};
+		ImVec2 size{};
+		bool   requested{ false };
 	};
 
 	struct GamepadIcon
@@ -23,10 +28,20 @@ namespace IconFont
 		IconTexture ps4;
 	};
 
+	// TTF file contents, kept alive for the atlas so font reloads don't hit the disk
+	struct FontFile
+	{
+		bool Load(const std::string& a_path, std::filesystem::file_time_type a_lastWriteTime);
+
+		// members
+		std::filesystem::file_time_type lastWriteTime{};
+		std::vector<char>               data{};
+	};
+
 	struct Font
 	{
 		void LoadSettings(const CSimpleIniA& a_ini, const char* a_section);
-		void LoadFont(const ImVector<ImWchar>& a_ranges);
+		void LoadFont(FontFile& a_file);
 
 		std::string name{};
 		float       size{};
@@ -41,8 +56,10 @@ namespace IconFont
 		void LoadSettings(CSimpleIniA& a_ini);
 		void LoadMCMSettings(const CSimpleIniA& a_ini);
 
-		void LoadIcons();
+		void PrefetchIcons();
+		void UpdateIcons();
 		void ReloadFonts();
+		void UpdateFonts();
 		void ResizeIcons();
 
 		std::pair<ImFont*, float> GetButtonFont() const;
@@ -50,12 +67,27 @@ namespace IconFont
 		std::pair<ImFont*, float> GetLocalHistoryFont() const;
 		std::pair<ImFont*, float> GetGlobalHistoryFont() const;
 
+		std::vector<std::filesystem::path> GetFontPaths() const;
+
 		const IconTexture*           GetIcon(std::uint32_t key);
 		std::set<const IconTexture*> GetIcons(const std::set<std::uint32_t>& keys);
 
-		const IconTexture* GetGamePadIcon(const GamepadIcon& a_icons) const;
+		IconTexture* GetGamePadIcon(GamepadIcon& a_icons) const;
+
+		void ReportMemory(MemoryReport::Report& a_report);
 
 	private:
+		using FontFiles = StringMap<FontFile>;
+
+		template <class F>
+		void ForEachIcon(F&& a_func);
+
+		const IconTexture* RequestIcon(IconTexture* a_icon);
+
+		static FontFiles LoadFontFiles(StringMap<std::filesystem::file_time_type> a_files);
+
+		std::uint64_t GetFontsKey();
+
 		enum class BUTTON_SCHEME
 		{
 			kAutoDetect,
@@ -72,6 +104,10 @@ namespace IconFont
 		bool loadFontsOnce{ false };
 		bool loadedFonts{ false };
 
+		FontFiles              fontFiles{};         // in use by the current atlas
+		std::future<FontFiles> pendingFontFiles{};  // changed files, read on a worker thread
+		std::uint64_t          fontsKey{ 0 };  // file + size + spacing of all loaded fonts
+
 		IconTexture unknownKey{ L"UnknownKey"sv };
 		IconTexture leftKey{ L"Left"sv };
 		IconTexture rightKey{ L"Right"sv };
@@ -206,8 +242,33 @@ namespace IconFont
 			{ 256 + MOUSE::kButton7, IconTexture(L"Mouse8"sv) },
 		};
 
+		ImGui::TextureAtlas             iconAtlas{};
+		std::vector<ImGui::AtlasImage*> requestedIcons{};
+		std::atomic_bool                prefetchIcons{ false };
+
 		BUTTON_SCHEME buttonScheme{ BUTTON_SCHEME::kAutoDetect };
 	};
+
+	template <class F>
+	inline void Manager::ForEachIcon(F&& a_func)
+	{
+		a_func(unknownKey);
+		a_func(upKey);
+		a_func(downKey);
+		a_func(leftKey);
+		a_func(rightKey);
+
+		for (auto& [key, icon] : keyboard) {
+			a_func(icon);
+		}
+		for (auto& [key, icon] : gamePad) {
+			a_func(icon.xbox);
+			a_func(icon.ps4);
+		}
+		for (auto& [key, icon] : mouse) {
+			a_func(icon);
+		}
+	}
 }
 
 namespace ImGui
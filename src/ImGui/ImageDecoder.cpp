@@ -0,0 +1,54 @@
+#include "ImageDecoder.h"
+
+namespace ImGui
+{
+	DecodedImage MakePlaceholder(std::uint32_t a_size)
+	{
+		constexpr std::uint32_t checker = 8;
+
+		DecodedImage image{ a_size, a_size, std::vector<std::uint8_t>(static_cast<std::size_t>(a_size) * a_size * 4) };
+
+		auto pixel = image.pixels.begin();
+		for (std::uint32_t y = 0; y < a_size; y++) {
+			for (std::uint32_t x = 0; x < a_size; x++) {
+				const bool magenta = (x / checker + y / checker) % 2 == 0;
+				*pixel++ = magenta ? 255 : 0;
+				*pixel++ = 0;
+				*pixel++ = magenta ? 255 : 0;
+				*pixel++ = 255;
+			}
+		}
+
+		return image;
+	}
+
+	std::vector<std::int32_t> DecodeParallel(IImageDecoder& a_decoder, std::span<const std::filesystem::path> a_paths, std::span<DecodedImage> a_images)
+	{
+		std::vector<std::int32_t> results(a_paths.size(), 0);
+		if (a_paths.empty()) {
+			return results;
+		}
+
+		std::atomic<std::size_t> next{ 0 };
+
+		const auto numThreads = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, a_paths.size());
+
+		// joined before results is returned
+		{
+			std::vector<std::jthread> workers;
+			workers.reserve(numThreads);
+
+			for (std::size_t i = 0; i < numThreads; i++) {
+				workers.emplace_back([&]() {
+					a_decoder.BeginThread();
+					for (auto idx = next++; idx < a_paths.size(); idx = next++) {
+						results[idx] = a_decoder.Decode(a_paths[idx], a_images[idx]);
+					}
+					a_decoder.EndThread();
+				});
+			}
+		}
+
+		return results;
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+namespace ImGui
+{
+	// RGBA8, rows tightly packed
+	struct DecodedImage
+	{
+		bool empty() const { return pixels.empty(); }
+
+		std::uint32_t GetRowPitch() const { return width * 4; }
+
+		// members
+		std::uint32_t             width{ 0 };
+		std::uint32_t             height{ 0 };
+		std::vector<std::uint8_t> pixels{};
+	};
+
+	class IImageDecoder
+	{
+	public:
+		virtual ~IImageDecoder() = default;
+
+		// around each worker thread of DecodeParallel
+		virtual void BeginThread() {}
+		virtual void EndThread() {}
+
+		// 0 on success, otherwise the decoder's error code (an HRESULT for WIC)
+		virtual std::int32_t Decode(const std::filesystem::path& a_path, DecodedImage& a_image) = 0;
+	};
+
+	// magenta and black checkers, stands in for an image that failed to decode
+	DecodedImage MakePlaceholder(std::uint32_t a_size = 32);
+
+	// a_images[i] is decoded from a_paths[i] on up to one thread per core, returns each file's error code
+	std::vector<std::int32_t> DecodeParallel(IImageDecoder& a_decoder, std::span<const std::filesystem::path> a_paths, std::span<DecodedImage> a_images);
+}
@@ -1,9 +1,12 @@
 #include "Renderer.h"
 
+#include "Capture.h"
 #include "GlobalHistory.h"
+#include "Hotkeys.h"
 #include "IconsFonts.h"
 #include "Input.h"
 #include "LocalHistory.h"
+#include "Profiler.h"
 #include "Styles.h"
 
 namespace ImGui::Renderer
@@ -15,6 +18,7 @@ namespace ImGui::Renderer
 			auto& io = ImGui::GetIO();
 			if (uMsg == WM_KILLFOCUS) {
 				io.ClearInputKeys();
+				MANAGER(Hotkeys)->ResetKeyState();
 			}
 
 			return func(hWnd, uMsg, wParam, lParam);
@@ -63,7 +67,7 @@ namespace ImGui::Renderer
 
 				logger::info("ImGui initialized.");
 
-				MANAGER(IconFont)->LoadIcons();
+				MANAGER(IconFont)->PrefetchIcons();
 
 				initialized.store(true);
 
@@ -85,36 +89,53 @@ namespace ImGui::Renderer
 	{
 		static void thunk(RE::IMenu* a_menu)
 		{
+			MANAGER(Capture)->Drain();
+
 			// Skip if Imgui is not loaded
 			if (!initialized.load()) {
 				return func(a_menu);
 			}
 
 			if (renderMenus.load()) {
-				// refresh style
-				ImGui::Styles::GetSingleton()->OnStyleRefresh();
-
-				ImGui_ImplDX11_NewFrame();
-				SKSE::ImGui_ImplWin32_NewFrame();
-				{
-					//trick imgui into rendering at game's real resolution (ie. if upscaled with Display Tweaks)
-					static const auto screenSize = RE::BSGraphics::Renderer::GetScreenSize();
-
-					auto& io = ImGui::GetIO();
-					io.DisplaySize.x = (float)screenSize.width;
-					io.DisplaySize.y = (float)screenSize.height;
-				}
-				ImGui::NewFrame();
 				{
-					// disable windowing
-					GImGui->NavWindowingTarget = nullptr;
-
-					MANAGER(LocalHistory)->Draw();
-					MANAGER(GlobalHistory)->Draw();
+					Profiler::ScopedTimer timer(Profiler::SECTION::kRender);
+
+					// refresh style
+					ImGui::Styles::GetSingleton()->OnStyleRefresh();
+					MANAGER(IconFont)->UpdateFonts();
+					MANAGER(IconFont)->UpdateIcons();
+
+					ImGui_ImplDX11_NewFrame();
+					SKSE::ImGui_ImplWin32_NewFrame();
+					{
+						//trick imgui into rendering at game's real resolution (ie. if upscaled with Display Tweaks)
+						static const auto screenSize = RE::BSGraphics::Renderer::GetScreenSize();
+
+						auto& io = ImGui::GetIO();
+						io.DisplaySize.x = (float)screenSize.width;
+						io.DisplaySize.y = (float)screenSize.height;
+					}
+					ImGui::NewFrame();
+					{
+						// disable windowing
+						GImGui->NavWindowingTarget = nullptr;
+
+						{
+							Profiler::ScopedTimer localTimer(Profiler::SECTION::kLocalHistory);
+							MANAGER(LocalHistory)->Draw();
+						}
+						{
+							Profiler::ScopedTimer globalTimer(Profiler::SECTION::kGlobalHistory);
+							MANAGER(GlobalHistory)->Draw();
+						}
+
+						MANAGER(Profiler)->Draw();
+					}
+					ImGui::EndFrame();
+					ImGui::Render();
+					ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
 				}
-				ImGui::EndFrame();
-				ImGui::Render();
-				ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+				MANAGER(Profiler)->EndFrame();
 			}
 
 			func(a_menu);
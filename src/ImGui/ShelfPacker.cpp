@@ -0,0 +1,107 @@
+#include "ShelfPacker.h"
+
+namespace ImGui
+{
+	ShelfPacker::ShelfPacker(std::uint32_t a_maxSize, std::uint32_t a_padding) :
+		maxSize(a_maxSize),
+		padding(a_padding)
+	{}
+
+	void ShelfPacker::Reserve(std::uint32_t a_width)
+	{
+		width = std::clamp(a_width, width, maxSize);
+	}
+
+	std::optional<ShelfPacker::Rect> ShelfPacker::Insert(std::uint32_t a_width, std::uint32_t a_height)
+	{
+		if (a_width == 0 || a_height == 0 || a_width + padding * 2 > maxSize || a_height + padding * 2 > maxSize) {
+			return std::nullopt;
+		}
+
+		if (a_width + padding * 2 > width) {
+			width = std::min(std::bit_ceil(a_width + padding * 2), maxSize);
+		}
+		if (height == 0) {
+			height = padding;
+		}
+
+		while (true) {
+			if (auto rect = InsertIntoShelves(a_width, a_height)) {
+				return rect;
+			}
+
+			// widen instead of stacking shelves past a square, existing shelves get the new room
+			const auto newHeight = height + a_height + padding;
+			if (newHeight > width && width < maxSize) {
+				width = std::min(width * 2, maxSize);
+				continue;
+			}
+
+			if (newHeight > maxSize) {
+				return std::nullopt;
+			}
+
+			auto& shelf = shelves.emplace_back(height, a_height, padding);
+			height = newHeight;
+
+			Rect rect{ shelf.x, shelf.y, a_width, a_height };
+			shelf.x += a_width + padding;
+			return rect;
+		}
+	}
+
+	// an empty atlas starts near square for the batch, so each shelf wastes little space
+	std::vector<std::optional<ShelfPacker::Rect>> ShelfPacker::InsertBatch(std::span<const Size> a_sizes)
+	{
+		std::vector<std::optional<Rect>> rects(a_sizes.size());
+		if (a_sizes.empty()) {
+			return rects;
+		}
+
+		if (shelves.empty()) {
+			std::uint32_t maxWidth = 0;
+			std::uint64_t area = 0;
+			for (const auto& [w, h] : a_sizes) {
+				maxWidth = std::max(maxWidth, w);
+				area += static_cast<std::uint64_t>(w + padding) * (h + padding);
+			}
+			Reserve(std::max(maxWidth + padding * 2, std::bit_ceil(static_cast<std::uint32_t>(std::sqrt(static_cast<double>(area))))));
+		}
+
+		std::vector<std::size_t> order(a_sizes.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::ranges::stable_sort(order, std::greater{}, [&](std::size_t a_idx) { return a_sizes[a_idx].h; });
+
+		for (const auto idx : order) {
+			rects[idx] = Insert(a_sizes[idx].w, a_sizes[idx].h);
+		}
+
+		return rects;
+	}
+
+	void ShelfPacker::Clear()
+	{
+		shelves.clear();
+		width = 0;
+		height = 0;
+	}
+
+	// shortest shelf the rect fits in, so tall shelves stay free for tall rects
+	std::optional<ShelfPacker::Rect> ShelfPacker::InsertIntoShelves(std::uint32_t a_width, std::uint32_t a_height)
+	{
+		Shelf* best = nullptr;
+		for (auto& shelf : shelves) {
+			if (shelf.height >= a_height && shelf.x + a_width + padding <= width && (!best || shelf.height < best->height)) {
+				best = &shelf;
+			}
+		}
+
+		if (!best) {
+			return std::nullopt;
+		}
+
+		Rect rect{ best->x, best->y, a_width, a_height };
+		best->x += a_width + padding;
+		return rect;
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+namespace ImGui
+{
+	// packs rects into rows (shelves) of an atlas. Placed rects never move, the atlas only gets wider or taller
+	class ShelfPacker
+	{
+	public:
+		struct Rect
+		{
+			std::uint32_t x{ 0 };
+			std::uint32_t y{ 0 };
+			std::uint32_t w{ 0 };
+			std::uint32_t h{ 0 };
+		};
+
+		struct Size
+		{
+			std::uint32_t w{ 0 };
+			std::uint32_t h{ 0 };
+		};
+
+		ShelfPacker() = delete;
+		explicit ShelfPacker(std::uint32_t a_maxSize, std::uint32_t a_padding = 1);
+
+		// widens the atlas ahead of a batch, never shrinks it
+		void                Reserve(std::uint32_t a_width);
+		std::optional<Rect> Insert(std::uint32_t a_width, std::uint32_t a_height);
+		// tallest first, rects are returned in a_sizes order and are nullopt if the atlas is full
+		std::vector<std::optional<Rect>> InsertBatch(std::span<const Size> a_sizes);
+		void                Clear();
+
+		std::uint32_t GetWidth() const { return width; }
+		std::uint32_t GetHeight() const { return height; }  // used height, including the bottom padding
+
+	private:
+		struct Shelf
+		{
+			std::uint32_t y{ 0 };
+			std::uint32_t height{ 0 };
+			std::uint32_t x{ 0 };  // next free column
+		};
+
+		std::optional<Rect> InsertIntoShelves(std::uint32_t a_width, std::uint32_t a_height);
+
+		// members
+		std::vector<Shelf> shelves{};
+		std::uint32_t      maxSize;
+		std::uint32_t      padding;
+		std::uint32_t      width{ 0 };
+		std::uint32_t      height{ 0 };
+	};
+}
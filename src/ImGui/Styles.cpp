@@ -38,12 +38,10 @@ namespace ImGui
 		}
 	}
 
-	void Styles::LoadStyles(CSimpleIniA& a_ini)
+	void Styles::LoadStyles(const CSimpleIniA& a_ini)
 	{
-#define GET_VALUE(a_value, a_section, a_key)                                                                                                        \
-	bool a_value##_hex = false;                                                                                                                     \
-	std::tie(user.a_value, a_value##_hex) = ToStyle<decltype(user.a_value)>(a_ini.GetValue(a_section, a_key, ToString(def.a_value, true).c_str())); \
-	a_ini.SetValue(a_section, a_key, ToString(user.a_value, a_value##_hex).c_str());
+#define GET_VALUE(a_value, a_section, a_key) \
+	user.a_value = ToStyle(a_ini.GetValue(a_section, a_key), def.a_value);
 
 		GET_VALUE(background, "Window", "rBackgroundColor");
 		GET_VALUE(border, "Window", "rBorderColor");
@@ -73,18 +71,8 @@ namespace ImGui
 #undef GET_VALUE
 	}
 
-	void Styles::OnStyleRefresh()
+	void Styles::ApplyStyle() const
 	{
-		if (!refreshStyle) {
-			return;
-		}
-
-		refreshStyle = false;
-
-		Settings::GetSingleton()->Load(FileType::kStyles, [this](auto& ini) {
-			LoadStyles(ini);
-		});
-
 		ImGuiStyle style{};
 		auto&      colors = style.Colors;
 
@@ -122,14 +110,31 @@ namespace ImGui
 		style.ScaleAllSizes(DisplayTweaks::GetResolutionScale());
 
 		ImGui::GetStyle() = style;
+	}
 
-		// reload fonts/icons
-		Settings::GetSingleton()->Load(FileType::kFonts, [this](auto& ini) {
-			MANAGER(IconFont)->LoadSettings(ini);
-		});
+	// only files that changed since the last refresh are parsed, the style/atlas are left alone otherwise
+	void Styles::OnStyleRefresh()
+	{
+		if (!refreshStyle) {
+			return;
+		}
+
+		refreshStyle = false;
+
+		const auto settings = Settings::GetSingleton();
+
+		if (settings->Load(FileType::kStyles, stylesFingerprint, [this](auto& ini) { LoadStyles(ini); }) || !loaded) {
+			ApplyStyle();
+			MANAGER(IconFont)->ResizeIcons();
+		}
+
+		// a replaced font file reloads the fonts even if fonts.ini is untouched
+		if (settings->Load(FileType::kFonts, fontsFingerprint, [](auto& ini) { MANAGER(IconFont)->LoadSettings(ini); }) || !loaded) {
+			fontsFingerprint.TrackFiles(MANAGER(IconFont)->GetFontPaths());
+			MANAGER(IconFont)->ReloadFonts();
+		}
 
-		MANAGER(IconFont)->ReloadFonts();
-		MANAGER(IconFont)->ResizeIcons();
+		loaded = true;
 	}
 
 	void Styles::RefreshStyle()
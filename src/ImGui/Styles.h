@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Settings.h"
+
 namespace ImGui
 {
 	enum class USER_STYLE
@@ -20,16 +22,18 @@ namespace ImGui
 		ImVec4 GetColorVec4(USER_STYLE a_style) const;
 		float  GetVar(USER_STYLE a_style) const;
 
-		void LoadStyles(CSimpleIniA& a_ini);
+		void LoadStyles(const CSimpleIniA& a_ini);
 
 		void OnStyleRefresh();
 		void RefreshStyle();
 
 	private:
+		static std::optional<ImVec4> ParseColor(std::string_view a_str);
+
 		template <class T>
-		std::pair<T, bool> ToStyle(const std::string& a_str);
-		template <class T>
-		std::string ToString(const T& a_style, bool a_hex);
+		static T ToStyle(const char* a_str, const T& a_default);
+
+		void ApplyStyle() const;
 
 		// members
 		struct Style
@@ -75,54 +79,73 @@ namespace ImGui
 		Style def;
 		Style user;
 
+		FileFingerprint stylesFingerprint{};
+		FileFingerprint fontsFingerprint{};
+
 		bool refreshStyle{ false };
+		bool loaded{ false };
 	};
 
 	ImVec4 GetUserStyleColorVec4(USER_STYLE a_style);
 	float  GetUserStyleVar(USER_STYLE a_style);
 
-	template <class T>
-	inline std::pair<T, bool> Styles::ToStyle(const std::string& a_str)
+	// "r,g,b,a" (0-255, larger values are clamped) or "#RRGGBBAA"
+	inline std::optional<ImVec4> Styles::ParseColor(std::string_view a_str)
 	{
-		if constexpr (std::is_same_v<ImVec4, T>) {
-			static srell::regex rgb_pattern("([0-9]+),([0-9]+),([0-9]+),([0-9]+)");
-			static srell::regex hex_pattern("#([0-9a-fA-F]{2})([0-9a-fA-F]{2})([0-9a-fA-F]{2})([0-9a-fA-F]{2})");
-
-			srell::smatch rgb_matches;
-			srell::smatch hex_matches;
-
-			if (srell::regex_match(a_str, rgb_matches, rgb_pattern)) {
-				auto red = std::stoi(rgb_matches[1]);
-				auto green = std::stoi(rgb_matches[2]);
-				auto blue = std::stoi(rgb_matches[3]);
-				auto alpha = std::stoi(rgb_matches[4]);
-
-				return { { red / 255.0f, green / 255.0f, blue / 255.0f, alpha / 255.0f }, false };
-			} else if (srell::regex_match(a_str, hex_matches, hex_pattern)) {
-				auto red = std::stoi(hex_matches[1], 0, 16);
-				auto green = std::stoi(hex_matches[2], 0, 16);
-				auto blue = std::stoi(hex_matches[3], 0, 16);
-				auto alpha = std::stoi(hex_matches[4], 0, 16);
-
-				return { { red / 255.0f, green / 255.0f, blue / 255.0f, alpha / 255.0f }, true };
-			}
+		std::array<std::uint32_t, 4> channels{};
+
+		const auto begin = a_str.data();
+		const auto end = begin + a_str.size();
 
-			return { T(), false };
+		if (a_str.starts_with('#')) {
+			if (a_str.size() != 9) {
+				return std::nullopt;
+			}
+			for (std::size_t i = 0; i < channels.size(); i++) {
+				const auto first = begin + 1 + i * 2;
+				const auto [ptr, ec] = std::from_chars(first, first + 2, channels[i], 16);
+				if (ec != std::errc() || ptr != first + 2) {
+					return std::nullopt;
+				}
+			}
 		} else {
-			return { string::to_num<T>(a_str), false };
+			auto it = begin;
+			for (std::size_t i = 0; i < channels.size(); i++) {
+				const auto [ptr, ec] = std::from_chars(it, end, channels[i]);
+				if (ec != std::errc()) {
+					return std::nullopt;
+				}
+				if (channels[i] > 255) {
+					logger::warn("Color \"{}\" has a component over 255 ({}), clamped to 255", a_str, channels[i]);
+					channels[i] = 255;
+				}
+				it = ptr;
+				if (i < channels.size() - 1) {
+					if (it == end || *it != ',') {
+						return std::nullopt;
+					}
+					++it;
+				}
+			}
+			if (it != end) {
+				return std::nullopt;
+			}
 		}
+
+		return ImVec4(channels[0] / 255.0f, channels[1] / 255.0f, channels[2] / 255.0f, channels[3] / 255.0f);
 	}
 
 	template <class T>
-	inline std::string Styles::ToString(const T& a_style, bool a_hex)
+	inline T Styles::ToStyle(const char* a_str, const T& a_default)
 	{
+		if (!a_str) {
+			return a_default;
+		}
+
 		if constexpr (std::is_same_v<ImVec4, T>) {
-			if (a_hex) {
-				return std::format("#{:02X}{:02X}{:02X}{:02X}", static_cast<std::uint8_t>(255.0f * a_style.x), static_cast<std::uint8_t>(255.0f * a_style.y), static_cast<std::uint8_t>(255.0f * a_style.z), static_cast<std::uint8_t>(255.0f * a_style.w));
-			}
-			return std::format("{},{},{},{}", static_cast<std::uint8_t>(255.0f * a_style.x), static_cast<std::uint8_t>(255.0f * a_style.y), static_cast<std::uint8_t>(255.0f * a_style.z), static_cast<std::uint8_t>(255.0f * a_style.w));
+			return ParseColor(a_str).value_or(a_default);
 		} else {
-			return std::format("{:.3f}", a_style);
+			return string::to_num<T>(a_str);
 		}
 	}
 }
@@ -1,8 +1,5 @@
 #include "Util.h"
 
-#include "IconsFonts.h"
-#include "Renderer.h"
-
 namespace ImGui
 {
 	void ExtendWindowPastBorder()
@@ -45,15 +42,159 @@ namespace ImGui
 		ImGui::TextUnformatted(label);
 	}
 
-	void TextColoredWrapped(const ImVec4& col, const char* fmt, ...)
+	bool BeginLog(const char* str_id)
+	{
+		PushStyleColor(ImGuiCol_ChildBg, ImVec4());
+		const bool open = BeginChild(str_id, ImVec2(0.0f, 0.0f), ImGuiChildFlags_None, ImGuiWindowFlags_NoBackground);
+		if (!open) {
+			EndChild();
+			PopStyleColor();
+		}
+		return open;
+	}
+
+	void EndLog()
 	{
-		PushStyleColor(ImGuiCol_Text, col);
-		PushTextWrapPos(0.0f);
-		TextUnformatted(fmt);
-		PopTextWrapPos();
+		EndChild();
 		PopStyleColor();
 	}
 
+	// time | name | : columns in front of the wrapped line
+	static float GetLineOffset(const LogRowLayout& layout)
+	{
+		const float spacing = GetStyle().ItemSpacing.x;
+
+		float offset = layout.nameWidth + spacing + layout.colonWidth + spacing;
+		if (layout.timeWidth > 0.0f) {
+			offset += layout.timeWidth + spacing;
+		}
+		return offset;
+	}
+
+	// draws the whole row straight into the window drawlist and registers it as one item, so IsItemHovered/IsItemSelected work on it
+	bool LogRow(const void* ptr_id, const LogRowLayout& layout, const LogRowData& data, float height)
+	{
+		ImGuiWindow* window = GetCurrentWindow();
+		if (window->SkipItems) {
+			return false;
+		}
+
+		const ImGuiStyle& style = GetStyle();
+		const ImVec2      pos = window->DC.CursorPos;
+
+		float nameX = pos.x;
+		if (layout.timeWidth > 0.0f) {
+			nameX += layout.timeWidth + style.ItemSpacing.x;
+		}
+		const float colonX = nameX + layout.nameWidth + style.ItemSpacing.x;
+		const float lineX = colonX + layout.colonWidth + style.ItemSpacing.x;
+		const float wrapWidth = ImMax(window->WorkRect.Max.x - lineX, 1.0f);
+
+		// same gap as the old table rows (three Spacing() calls)
+		const ImRect bb(pos, ImVec2(window->WorkRect.Max.x, pos.y + height));
+		ItemSize(ImVec2(bb.GetWidth(), height + style.ItemSpacing.y * 3));
+
+		if (!ItemAdd(bb, window->GetID(ptr_id))) {
+			return false;
+		}
+
+		ImDrawList* drawList = window->DrawList;
+		ImFont*     font = GetFont();
+		const float fontSize = GetFontSize();
+
+		if (data.time) {
+			drawList->AddText(font, fontSize, pos, GetColorU32(ImGuiCol_Text), data.time);
+		}
+		drawList->AddText(font, fontSize, ImVec2(nameX, pos.y), data.nameColor, data.name);
+		drawList->AddText(font, fontSize, ImVec2(colonX, pos.y), data.nameColor, ":");
+		drawList->AddText(font, fontSize, ImVec2(lineX, pos.y), IsItemHovered() ? data.hoveredLineColor : data.lineColor, data.line, nullptr, wrapWidth);
+
+		return true;
+	}
+
+	void LogClipper::Clear()
+	{
+		heights.clear();
+		offsets.clear();
+		wrapWidth = 0.0f;
+	}
+
+	// returns the first row to measure, cached heights are dropped when the wrap width, font or row count changes
+	std::size_t LogClipper::Prepare(const LogRowLayout& a_layout, std::size_t a_count)
+	{
+		const ImGuiWindow* window = GetCurrentWindowRead();
+
+		active = !window->SkipItems;
+		if (!active) {
+			return a_count;
+		}
+
+		const float width = ImMax(window->WorkRect.Max.x - (window->DC.CursorPos.x + GetLineOffset(a_layout)), 1.0f);
+		const float size = GetFontSize();
+		const float spacing = GetStyle().ItemSpacing.y * 4;  // LogRow gap + ItemSize spacing
+
+		if (width != wrapWidth || size != fontSize || spacing != rowSpacing || a_count != heights.size()) {
+			Clear();
+			wrapWidth = width;
+			fontSize = size;
+			rowSpacing = spacing;
+
+			heights.reserve(a_count);
+			offsets.reserve(a_count + 1);
+			offsets.push_back(0.0f);
+		}
+
+		return heights.size();
+	}
+
+	void LogClipper::AddRow(const char* a_line)
+	{
+		const float height = ImMax(CalcTextSize(a_line, nullptr, false, wrapWidth).y, GetTextLineHeight());
+
+		heights.push_back(height);
+		offsets.push_back(offsets.back() + height + rowSpacing);
+	}
+
+	std::pair<std::size_t, std::size_t> LogClipper::Clip()
+	{
+		if (!active) {
+			return { 0, 0 };
+		}
+
+		const ImGuiWindow* window = GetCurrentWindowRead();
+		const float        top = window->DC.CursorPos.y;
+		const std::size_t  count = heights.size();
+
+		// one extra row on each side, ItemSize truncates the cursor so offsets can drift by a pixel
+		const auto firstIt = std::ranges::upper_bound(offsets, window->ClipRect.Min.y - top);
+		const auto lastIt = std::ranges::lower_bound(offsets, window->ClipRect.Max.y - top);
+
+		std::size_t first = static_cast<std::size_t>(std::distance(offsets.begin(), firstIt));
+		first = first > 1 ? ImMin(first - 2, count) : 0;
+		last = ImMin(static_cast<std::size_t>(std::distance(offsets.begin(), lastIt)) + 1, count);
+		if (last < first) {
+			last = first;
+		}
+
+		if (first > 0) {
+			ItemSize(ImVec2(0.0f, offsets[first] - GetStyle().ItemSpacing.y));
+		}
+
+		return { first, last };
+	}
+
+	void LogClipper::End()
+	{
+		if (!active) {
+			return;
+		}
+		active = false;
+
+		if (const float remaining = offsets.back() - offsets[last]; remaining > 0.0f) {
+			ItemSize(ImVec2(0.0f, remaining - GetStyle().ItemSpacing.y));
+		}
+	}
+
 	// https://github.com/ocornut/imgui/issues/1537#issuecomment-355569554
 	bool ToggleButton(const char* str_id, bool* v)
 	{
@@ -2,12 +2,61 @@
 
 namespace ImGui
 {
+	// single row of a dialogue log (time | name | : | wrapped line)
+	struct LogRowLayout
+	{
+		float timeWidth{ 0.0f };  // 0 to skip time column
+		float nameWidth{ 0.0f };
+		float colonWidth{ 0.0f };
+	};
+
+	struct LogRowData
+	{
+		const char* time{ nullptr };
+		const char* name{ nullptr };
+		const char* line{ nullptr };
+		ImU32       nameColor{};
+		ImU32       lineColor{};
+		ImU32       hoveredLineColor{};
+	};
+
+	// row heights of one log, measured once per wrap width so rows outside the window are skipped without measuring their text
+	class LogClipper
+	{
+	public:
+		// measures rows that aren't cached and skips the ones above the window, returns the visible rows [first, last)
+		template <class F>
+		std::pair<std::size_t, std::size_t> Begin(const LogRowLayout& a_layout, std::size_t a_count, F&& a_getLine);
+		void                                End();  // skips the rows below the window
+
+		float GetRowHeight(std::size_t a_index) const { return heights[a_index]; }
+
+		void Clear();  // after the rows change
+
+	private:
+		std::size_t                         Prepare(const LogRowLayout& a_layout, std::size_t a_count);
+		void                                AddRow(const char* a_line);
+		std::pair<std::size_t, std::size_t> Clip();
+
+		// members
+		std::vector<float> heights{};
+		std::vector<float> offsets{};  // top of each row relative to the first, plus the total height
+		float              wrapWidth{ 0.0f };
+		float              fontSize{ 0.0f };
+		float              rowSpacing{ 0.0f };
+		std::size_t        last{ 0 };
+		bool               active{ false };
+	};
+
 	void ExtendWindowPastBorder();
 
 	void AlignForWidth(float width, float alignment = 0.5f);
 
 	void CenteredText(const char* label, bool vertical);
-	void TextColoredWrapped(const ImVec4& col, const char* fmt, ...);
+
+	bool BeginLog(const char* str_id);
+	void EndLog();
+	bool LogRow(const void* ptr_id, const LogRowLayout& layout, const LogRowData& data, float height);  // height from LogClipper
 
 	bool ToggleButton(const char* label, bool* v);
 
@@ -18,4 +67,13 @@ namespace ImGui
 	ImVec2 GetNativeViewportSize();
 	ImVec2 GetNativeViewportPos();
 	ImVec2 GetNativeViewportCenter();
+
+	template <class F>
+	inline std::pair<std::size_t, std::size_t> LogClipper::Begin(const LogRowLayout& a_layout, std::size_t a_count, F&& a_getLine)
+	{
+		for (auto i = Prepare(a_layout, a_count); i < a_count; i++) {
+			AddRow(a_getLine(i));
+		}
+		return Clip();
+	}
 }
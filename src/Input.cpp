@@ -2,6 +2,7 @@
 
 #include "GlobalHistory.h"
 #include "Hotkeys.h"
+#include "ImGui/IconsFonts.h"
 #include "LocalHistory.h"
 
 namespace Input
@@ -339,6 +340,8 @@ namespace Input
 				io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
 				io.ConfigFlags &= ~ImGuiConfigFlags_NavEnableGamepad;
 			}
+
+			MANAGER(IconFont)->PrefetchIcons();
 		}
 	}
 
@@ -357,7 +360,7 @@ namespace Input
 		return inputDevice == DEVICE::kGamepadDirectX || inputDevice == DEVICE::kGamepadOrbis;
 	}
 
-	void Manager::ProcessInputEvents(RE::InputEvent* const* a_events)
+	void Manager::ProcessEvents(std::span<const Event> a_events)
 	{
 		auto& io = ImGui::GetIO();
 
@@ -368,31 +371,19 @@ namespace Input
 		const bool anyHistoryMenuOpen = drawGlobalHistory || drawLocalHistory;
 
 		if (anyHistoryMenuOpen || dialogueMenuOpen) {
-			auto cursorMenu = RE::UI::GetSingleton()->GetMenu<RE::CursorMenu>();
-
-			for (auto event = *a_events; event; event = event->next) {
-				UpdateInputDevice(event->GetDevice());
+			for (const auto& event : a_events) {
+				UpdateInputDevice(event.device);
 
 				if (!anyHistoryMenuOpen) {
 					continue;
 				}
 
-				if (auto mouseEvent = event->AsMouseMoveEvent()) {
-					// pass in mouse pos to cursor menu, since we're blocking the main input queue
-					if (drawGlobalHistory && cursorMenu) {
-						cursorMenu->ProcessMouseMove(mouseEvent);
-					}
-				} else if (const auto thumbstickEvent = event->AsThumbstickEvent()) {
-					// pass in thumbstick pos to cursor menu, since we're blocking the main input queue
-					if (drawGlobalHistory && cursorMenu) {
-						cursorMenu->ProcessThumbstick(thumbstickEvent);
-					}
-				} else if (const auto charEvent = event->AsCharEvent()) {
+				if (event.type == Event::TYPE::kChar) {
 					if (drawGlobalHistory) {
-						io.AddInputCharacter(charEvent->keyCode);
+						io.AddInputCharacter(event.idCode);
 					}
-				} else if (const auto buttonEvent = event->AsButtonEvent()) {
-					const auto key = buttonEvent->GetIDCode();
+				} else if (event.type == Event::TYPE::kButton) {
+					const auto key = event.idCode;
 
 					switch (inputDevice) {
 					case DEVICE::kKeyboard:
@@ -403,48 +394,40 @@ namespace Input
 								continue;
 							}
 							if (imKey == ImGuiKey_Tab) {
-								io.AddKeyEvent(imKey, buttonEvent->IsDown());
+								io.AddKeyEvent(imKey, event.IsDown());
 							} else {
-								io.AddKeyEvent(imKey, buttonEvent->IsPressed());
+								io.AddKeyEvent(imKey, event.IsPressed());
 							}
 						}
 						break;
 					case DEVICE::kMouse:
 						{
-							switch (auto mouseKey = static_cast<MOUSE>(key)) {
+							switch (static_cast<MOUSE>(key)) {
 							case MOUSE::kWheelUp:
-								io.AddMouseWheelEvent(0, buttonEvent->Value());
+								io.AddMouseWheelEvent(0, event.value);
 								break;
 							case MOUSE::kWheelDown:
-								io.AddMouseWheelEvent(0, buttonEvent->Value() * -1);
+								io.AddMouseWheelEvent(0, event.value * -1);
 								break;
 							default:
-								io.AddMouseButtonEvent(key, buttonEvent->IsPressed());
+								io.AddMouseButtonEvent(key, event.IsPressed());
 								break;
 							}
 						}
 						break;
 					case DEVICE::kGamepadDirectX:
-						io.AddKeyEvent(ToImGuiKey(static_cast<GAMEPAD_DIRECTX>(key)), buttonEvent->IsPressed());
+						io.AddKeyEvent(ToImGuiKey(static_cast<GAMEPAD_DIRECTX>(key)), event.IsPressed());
 						break;
 					case DEVICE::kGamepadOrbis:
-						io.AddKeyEvent(ToImGuiKey(static_cast<GAMEPAD_ORBIS>(key)), buttonEvent->IsPressed());
+						io.AddKeyEvent(ToImGuiKey(static_cast<GAMEPAD_ORBIS>(key)), event.IsPressed());
 						break;
 					default:
 						break;
 					}
-
-					if (buttonEvent->QUserEvent() == RE::UserEvents::GetSingleton()->screenshot) {
-						if (buttonEvent->IsDown() && drawGlobalHistory) {
-							RE::MenuControls::GetSingleton()->QueueScreenshot();
-						}
-					}
 				}
 			}
 		}
 
-		if (!io.WantTextInput) {
-			MANAGER(Hotkeys)->TryToggleDialogueHistory(a_events);
-		}
+		MANAGER(Hotkeys)->UpdateKeyState(a_events);
 	}
 }
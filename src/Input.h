@@ -11,6 +11,28 @@ namespace Input
 		kGamepadOrbis     // ps4
 	};
 
+	// engine-independent copy of the events the menus and hotkeys consume, so they can be recorded and replayed
+	struct Event
+	{
+		enum class TYPE : std::uint8_t
+		{
+			kOther,  // only updates the input device
+			kButton,
+			kChar
+		};
+
+		bool IsPressed() const { return value > 0.0f; }
+		bool IsDown() const { return value != 0.0f && heldDownSecs == 0.0f; }
+
+		// members
+		TYPE             type{ TYPE::kOther };
+		RE::INPUT_DEVICE device{ RE::INPUT_DEVICE::kNone };
+		std::uint32_t    idCode{ 0 };  // button id or character
+		float            value{ 0.0f };
+		float            heldDownSecs{ 0.0f };
+	};
+	static_assert(std::is_trivially_copyable_v<Event>);
+
 	class Manager :
 		public REX::Singleton<Manager>
 	{
@@ -22,6 +44,7 @@ namespace Input
 		bool   IsInputGamepad() const;
 
 		void ProcessInputEvents(RE::InputEvent* const* a_events);
+		void ProcessEvents(std::span<const Event> a_events);
 
 	private:
 		static ImGuiKey ToImGuiKey(KEY a_key);
@@ -31,7 +54,8 @@ namespace Input
 		void UpdateInputDevice(RE::INPUT_DEVICE a_device);
 
 		// members
-		DEVICE inputDevice{ DEVICE::kNone };
-		DEVICE lastInputDevice{ DEVICE::kNone };
+		DEVICE             inputDevice{ DEVICE::kNone };
+		DEVICE             lastInputDevice{ DEVICE::kNone };
+		std::vector<Event> events{};
 	};
 }
@@ -0,0 +1,49 @@
+#include "Input.h"
+
+#include "GlobalHistory.h"
+#include "InputRecorder.h"
+
+// the game's input queue, copied into Input::Event batches. The rest of Input.cpp never sees an engine event
+namespace Input
+{
+	void Manager::ProcessInputEvents(RE::InputEvent* const* a_events)
+	{
+		const bool drawGlobalHistory = MANAGER(GlobalHistory)->IsGlobalHistoryOpen();
+
+		auto cursorMenu = drawGlobalHistory ? RE::UI::GetSingleton()->GetMenu<RE::CursorMenu>() : nullptr;
+
+		events.clear();
+
+		for (auto event = *a_events; event; event = event->next) {
+			auto& copy = events.emplace_back();
+			copy.device = event->GetDevice();
+
+			if (auto mouseEvent = event->AsMouseMoveEvent()) {
+				// pass in mouse pos to cursor menu, since we're blocking the main input queue
+				if (cursorMenu) {
+					cursorMenu->ProcessMouseMove(mouseEvent);
+				}
+			} else if (const auto thumbstickEvent = event->AsThumbstickEvent()) {
+				// pass in thumbstick pos to cursor menu, since we're blocking the main input queue
+				if (cursorMenu) {
+					cursorMenu->ProcessThumbstick(thumbstickEvent);
+				}
+			} else if (const auto charEvent = event->AsCharEvent()) {
+				copy.type = Event::TYPE::kChar;
+				copy.idCode = charEvent->keyCode;
+			} else if (const auto buttonEvent = event->AsButtonEvent()) {
+				copy.type = Event::TYPE::kButton;
+				copy.idCode = buttonEvent->GetIDCode();
+				copy.value = buttonEvent->Value();
+				copy.heldDownSecs = buttonEvent->HeldDuration();
+
+				if (drawGlobalHistory && buttonEvent->IsDown() && buttonEvent->QUserEvent() == RE::UserEvents::GetSingleton()->screenshot) {
+					RE::MenuControls::GetSingleton()->QueueScreenshot();
+				}
+			}
+		}
+
+		// while replaying, the recorded batch replaces live input
+		ProcessEvents(MANAGER(InputRecorder)->Process(events));
+	}
+}
@@ -0,0 +1,203 @@
+#include "InputRecorder.h"
+
+#include "ImGui/Renderer.h"
+
+namespace InputRecorder
+{
+	// settings are applied on the input thread, the next time Process runs
+	void Manager::LoadMCMSettings(const CSimpleIniA& a_ini)
+	{
+		recordInput.store(a_ini.GetBoolValue("Settings", "bRecordInput", recordInput.load()));
+		replayInput.store(a_ini.GetBoolValue("Settings", "bReplayInput", replayInput.load()));
+	}
+
+	std::optional<std::filesystem::path> Manager::GetFilePath()
+	{
+		if (auto path = logger::log_directory()) {
+			*path /= "DialogueHistory_Input.bin";
+			return path;
+		}
+		return std::nullopt;
+	}
+
+	std::span<const Input::Event> Manager::Process(std::span<const Input::Event> a_events)
+	{
+		if (const bool replay = replayInput.load(); replay != lastReplayInput) {
+			lastReplayInput = replay;
+			if (replay) {
+				StartReplay();
+			} else {
+				StopReplay();
+			}
+		}
+
+		if (IsReplaying()) {
+			if (replayBatch + 1 >= replayBatches.size()) {
+				StopReplay();
+				return a_events;
+			}
+
+			const auto begin = replayBatches[replayBatch];
+			const auto end = replayBatches[replayBatch + 1];
+			replayBatch++;
+
+			return { replayEvents.data() + begin, end - begin };
+		}
+
+		if (const bool record = recordInput.load(); record != recordFile.is_open()) {
+			if (record) {
+				StartRecording();
+			} else {
+				StopRecording();
+			}
+		}
+
+		// only frames where our menus are drawn
+		if (recordFile.is_open() && ImGui::Renderer::renderMenus.load()) {
+			Record(a_events);
+		}
+
+		return a_events;
+	}
+
+	void Manager::StartRecording()
+	{
+		const auto path = GetFilePath();
+		if (!path) {
+			recordInput.store(false);
+			return;
+		}
+
+		recordFile.open(*path, std::ios::binary | std::ios::trunc);
+		if (!recordFile.good()) {
+			logger::error("Unable to open {} for input recording", path->string());
+			recordFile.close();
+			recordInput.store(false);
+			return;
+		}
+
+		recordFile.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+		recordFile.write(reinterpret_cast<const char*>(&version), sizeof(version));
+
+		recordedBatches = 0;
+
+		logger::info("Recording input to {}", path->string());
+	}
+
+	void Manager::StopRecording()
+	{
+		recordFile.close();
+
+		logger::info("Recorded {} input batches", recordedBatches);
+	}
+
+	// [count][count * event]
+	void Manager::Record(std::span<const Input::Event> a_events)
+	{
+		const auto count = static_cast<std::uint32_t>(a_events.size());
+
+		recordFile.write(reinterpret_cast<const char*>(&count), sizeof(count));
+		for (const auto& event : a_events) {
+			WriteEvent(recordFile, event);
+		}
+
+		recordedBatches++;
+	}
+
+	// [type : u8][device : u32][idCode : u32][value : f32][heldDownSecs : f32]
+	void Manager::WriteEvent(std::ostream& a_stream, const Input::Event& a_event)
+	{
+		const auto type = std::to_underlying(a_event.type);
+		const auto device = static_cast<std::uint32_t>(a_event.device);
+
+		a_stream.write(reinterpret_cast<const char*>(&type), sizeof(type));
+		a_stream.write(reinterpret_cast<const char*>(&device), sizeof(device));
+		a_stream.write(reinterpret_cast<const char*>(&a_event.idCode), sizeof(a_event.idCode));
+		a_stream.write(reinterpret_cast<const char*>(&a_event.value), sizeof(a_event.value));
+		a_stream.write(reinterpret_cast<const char*>(&a_event.heldDownSecs), sizeof(a_event.heldDownSecs));
+	}
+
+	bool Manager::ReadEvent(std::istream& a_stream, Input::Event& a_event)
+	{
+		std::underlying_type_t<Input::Event::TYPE> type = 0;
+		std::uint32_t                              device = 0;
+
+		a_stream.read(reinterpret_cast<char*>(&type), sizeof(type));
+		a_stream.read(reinterpret_cast<char*>(&device), sizeof(device));
+		a_stream.read(reinterpret_cast<char*>(&a_event.idCode), sizeof(a_event.idCode));
+		a_stream.read(reinterpret_cast<char*>(&a_event.value), sizeof(a_event.value));
+		a_stream.read(reinterpret_cast<char*>(&a_event.heldDownSecs), sizeof(a_event.heldDownSecs));
+
+		a_event.type = static_cast<Input::Event::TYPE>(type);
+		a_event.device = static_cast<RE::INPUT_DEVICE>(device);
+
+		return a_stream.good();
+	}
+
+	void Manager::StartReplay()
+	{
+		StopReplay();
+
+		const auto path = GetFilePath();
+		if (!path) {
+			return;
+		}
+
+		std::error_code ec;
+		const auto      fileSize = std::filesystem::file_size(*path, ec);
+
+		std::ifstream file(*path, std::ios::binary);
+		if (ec || !file.good()) {
+			logger::error("Unable to open {} for input replay", path->string());
+			return;
+		}
+
+		std::uint32_t fileMagic = 0;
+		std::uint32_t fileVersion = 0;
+		file.read(reinterpret_cast<char*>(&fileMagic), sizeof(fileMagic));
+		file.read(reinterpret_cast<char*>(&fileVersion), sizeof(fileVersion));
+
+		if (!file.good() || fileMagic != magic || fileVersion != version) {
+			logger::error("{} is not a valid input recording", path->string());
+			return;
+		}
+
+		replayBatches.push_back(0);
+
+		std::uint32_t count = 0;
+		while (file.read(reinterpret_cast<char*>(&count), sizeof(count))) {
+			// a corrupt count would otherwise size the buffer before the reads fail
+			const auto remaining = fileSize - static_cast<std::uintmax_t>(file.tellg());
+			if (count > remaining / eventSize) {
+				logger::error("{} is corrupt, batch {} has {} events but only {} bytes are left", path->string(), replayBatches.size() - 1, count, remaining);
+				break;
+			}
+
+			const auto offset = replayEvents.size();
+			replayEvents.resize(offset + count);
+			if (!std::ranges::all_of(replayEvents | std::views::drop(offset), [&](auto& event) { return ReadEvent(file, event); })) {
+				replayEvents.resize(offset);  // truncated batch
+				break;
+			}
+			replayBatches.push_back(static_cast<std::uint32_t>(replayEvents.size()));
+		}
+
+		logger::info("Replaying {} input batches ({} events) from {}", replayBatches.size() - 1, replayEvents.size(), path->string());
+	}
+
+	void Manager::StopReplay()
+	{
+		if (IsReplaying()) {
+			logger::info("Input replay stopped after {} of {} batches", replayBatch, replayBatches.size() - 1);
+		}
+
+		replayEvents.clear();
+		replayBatches.clear();
+		replayBatch = 0;
+	}
+
+	bool Manager::IsReplaying() const
+	{
+		return !replayBatches.empty();
+	}
+}
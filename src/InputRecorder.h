@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Input.h"
+
+namespace InputRecorder
+{
+	// records the input batches seen while the menus are open, and plays them back in place of live input
+	class Manager : public REX::Singleton<Manager>
+	{
+	public:
+		void LoadMCMSettings(const CSimpleIniA& a_ini);
+
+		std::span<const Input::Event> Process(std::span<const Input::Event> a_events);
+
+		static std::optional<std::filesystem::path> GetFilePath();
+		bool                                        IsReplaying() const;
+
+	private:
+		static constexpr std::uint32_t magic{ 0x52494844 };  // "DHIR"
+		static constexpr std::uint32_t version{ 2 };
+		static constexpr std::size_t   eventSize{ sizeof(std::uint8_t) + sizeof(std::uint32_t) * 2 + sizeof(float) * 2 };  // as written by WriteEvent
+
+		// field by field, so struct padding never reaches the file
+		static void WriteEvent(std::ostream& a_stream, const Input::Event& a_event);
+		static bool ReadEvent(std::istream& a_stream, Input::Event& a_event);
+
+		void StartRecording();
+		void StopRecording();
+		void Record(std::span<const Input::Event> a_events);
+
+		void StartReplay();
+		void StopReplay();
+
+		// members
+		std::atomic<bool> recordInput{ false };  // set from the MCM on the main thread, read on the input thread
+		std::atomic<bool> replayInput{ false };
+		bool              lastReplayInput{ false };
+
+		std::ofstream recordFile{};
+		std::size_t   recordedBatches{ 0 };
+
+		std::vector<Input::Event>  replayEvents{};
+		std::vector<std::uint32_t> replayBatches{};  // offset of each batch into replayEvents, plus the end
+		std::size_t                replayBatch{ 0 };
+	};
+}
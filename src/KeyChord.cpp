@@ -0,0 +1,72 @@
+#include "KeyChord.h"
+
+namespace Hotkeys
+{
+	void ReleaseWheelKeys(KeyState& a_state)
+	{
+		a_state.reset(wheelUpKey);
+		a_state.reset(wheelDownKey);
+	}
+
+	void Chord::UpdateKeys()
+	{
+		keys.clear();
+		mask.reset();
+		for (const auto value : values) {
+			if (value >= 0 && static_cast<std::size_t>(value) < mask.size()) {
+				keys.insert(value);
+				mask.set(value);
+			}
+		}
+	}
+
+	bool Chord::Matches(const KeyState& a_state) const
+	{
+		return mask.any() && a_state == mask;
+	}
+
+	void Trigger::Reset()
+	{
+		down = false;
+		held = false;
+		lastTapTime.reset();
+	}
+
+	bool Trigger::Update(bool a_down, clock::time_point a_now, float a_holdTime, float a_doubleTapTime)
+	{
+		const bool wasDown = down;
+		down = a_down;
+
+		const bool pressed = down && !wasDown;
+
+		switch (type) {
+		case TRIGGER::kHold:
+			{
+				if (!down) {
+					held = false;
+				} else if (pressed) {
+					pressTime = a_now;
+				} else if (!held && a_now - pressTime >= std::chrono::duration<float>(a_holdTime)) {
+					held = true;
+					return true;
+				}
+			}
+			break;
+		case TRIGGER::kDoubleTap:
+			{
+				if (pressed) {
+					if (lastTapTime && a_now - *lastTapTime <= std::chrono::duration<float>(a_doubleTapTime)) {
+						lastTapTime.reset();
+						return true;
+					}
+					lastTapTime = a_now;
+				}
+			}
+			break;
+		default:
+			return pressed;
+		}
+
+		return false;
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+namespace Hotkeys
+{
+	// keyboard (0-255), mouse (256+) and gamepad (266+) keycodes
+	using KeyState = std::bitset<512>;
+
+	// the wheel sends presses without releases, so its keys only count as down for the frame that scrolled
+	inline constexpr std::uint32_t wheelUpKey = 256 + 8;
+	inline constexpr std::uint32_t wheelDownKey = 256 + 9;
+
+	void ReleaseWheelKeys(KeyState& a_state);  // after each frame's chords are evaluated
+
+	enum class TRIGGER
+	{
+		kPress,
+		kHold,
+		kDoubleTap
+	};
+
+	// any number of keys, matched exactly against the key state
+	struct Chord
+	{
+		void UpdateKeys();  // after values change
+
+		bool Matches(const KeyState& a_state) const;
+
+		// members
+		std::vector<std::int32_t> values{};  // primary, modifier, modifier2..., -1 if unset
+		std::set<std::uint32_t>   keys{};
+		KeyState                  mask{};
+	};
+
+	// turns chord down/up transitions into press, hold or double tap activations
+	class Trigger
+	{
+	public:
+		using clock = std::chrono::steady_clock;
+
+		void Reset();
+
+		// call every frame, not only on input events, or holds won't fire while no events arrive. True when it activates
+		bool Update(bool a_down, clock::time_point a_now, float a_holdTime, float a_doubleTapTime);
+
+		// members
+		TRIGGER type{ TRIGGER::kPress };
+
+	private:
+		bool                             down{ false };
+		bool                             held{ false };
+		clock::time_point                pressTime{};
+		std::optional<clock::time_point> lastTapTime{};
+	};
+}
@@ -1,9 +1,12 @@
 #include "LocalHistory.h"
 
+#include "Capture.h"
 #include "GlobalHistory.h"
 #include "Hotkeys.h"
 #include "ImGui/Renderer.h"
 #include "ImGui/Styles.h"
+#include "MemoryReport.h"
+#include "NPCNameProvider.h"
 
 namespace LocalHistory
 {
@@ -152,6 +155,14 @@ namespace LocalHistory
 
 	void Manager::SetDialogueMenuOpen(bool a_opened)
 	{
+		MANAGER(Capture)->Drain();
+		MANAGER(Capture)->RecordEvent(Capture::Session::EVENT::kDialogueMenu, a_opened);
+
+		// NND may reveal the speaker's name during dialogue
+		if (const auto speaker = RE::MenuTopicManager::GetSingleton()->speaker.get()) {
+			NPCNameProvider::GetSingleton()->InvalidateName(speaker->GetFormID());
+		}
+
 		dialogueMenuOpen = a_opened;
 
 		if (!dialogueMenuOpen) {
@@ -247,6 +258,11 @@ namespace LocalHistory
 		MANAGER(GlobalHistory)->SaveDialogueHistory(gameTime, localDialogue);
 	}
 
+	void Manager::ReportMemory(MemoryReport::Report& a_report) const
+	{
+		a_report.Add("LocalHistory::localDialogue", { localDialogue.dialogue.size(), MemoryReport::Measure(localDialogue).bytes });
+	}
+
 	void Manager::UpdateDialogue()
 	{
 		auto calendar = RE::Calendar::GetSingleton();
@@ -2,6 +2,11 @@
 
 #include "Dialogue.h"
 
+namespace MemoryReport
+{
+	class Report;
+}
+
 namespace LocalHistory
 {
 	class Manager :
@@ -27,6 +32,8 @@ namespace LocalHistory
 		void AddDialogue(RE::TESObjectREFR* a_speaker, const std::string& a_response, const std::string& a_voice);
 		void SaveDialogueHistory();
 
+		void ReportMemory(MemoryReport::Report& a_report) const;
+
 	private:
 		void UpdateDialogue();
 
@@ -0,0 +1,89 @@
+#include "MemoryReport.h"
+
+#include "GlobalHistory.h"
+#include "ImGui/IconsFonts.h"
+#include "LocalHistory.h"
+#include "NPCNameProvider.h"
+
+namespace MemoryReport
+{
+	void Report::Add(std::string_view a_name, const Usage& a_usage)
+	{
+		entries.emplace_back(a_name, a_usage);
+	}
+
+	Usage Report::GetTotal() const
+	{
+		Usage total;
+		for (const auto& usage : entries | std::views::values) {
+			total += usage;
+		}
+		return total;
+	}
+
+	std::string Report::ToString() const
+	{
+		std::string str = std::format("Total : {}", FormatBytes(GetTotal().bytes));
+		for (const auto& [name, usage] : entries) {
+			std::format_to(std::back_inserter(str), "\n{} : {} ({})", name, FormatBytes(usage.bytes), usage.count);
+		}
+		return str;
+	}
+
+	std::string Report::FormatBytes(std::size_t a_bytes)
+	{
+		if (a_bytes < 1024) {
+			return std::format("{} B", a_bytes);
+		}
+		if (a_bytes < 1024 * 1024) {
+			return std::format("{:.1f} KB", a_bytes / 1024.0);
+		}
+		return std::format("{:.2f} MB", a_bytes / (1024.0 * 1024.0));
+	}
+
+	Report Collect()
+	{
+		Report report;
+
+		MANAGER(GlobalHistory)->ReportMemory(report);
+		MANAGER(LocalHistory)->ReportMemory(report);
+		NPCNameProvider::GetSingleton()->ReportMemory(report);
+		MANAGER(IconFont)->ReportMemory(report);
+
+		return report;
+	}
+
+	void Log(std::string_view a_reason)
+	{
+		auto report = Collect().ToString();
+
+		logger::info("{:*^50}", std::format("MEMORY ({})", a_reason));
+		logger::info("{}", report);
+
+		MANAGER(MemoryReport)->SetReport(std::move(report));
+	}
+
+	std::string Manager::GetReport() const
+	{
+		std::scoped_lock locker(lock);
+		return report;
+	}
+
+	void Manager::SetReport(std::string a_report)
+	{
+		std::scoped_lock locker(lock);
+		report = std::move(a_report);
+	}
+
+	void Manager::QueueUpdate()
+	{
+		if (updateQueued.exchange(true)) {
+			return;
+		}
+
+		SKSE::GetTaskInterface()->AddTask([this]() {
+			SetReport(Collect().ToString());
+			updateQueued.store(false);
+		});
+	}
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Dialogue.h"
+
+namespace MemoryReport
+{
+	struct Usage
+	{
+		Usage& operator+=(const Usage& a_rhs)
+		{
+			count += a_rhs.count;
+			bytes += a_rhs.bytes;
+			return *this;
+		}
+
+		// members
+		std::size_t count{ 0 };  // entries
+		std::size_t bytes{ 0 };
+	};
+
+	template <class T, template <class...> class U>
+	inline constexpr bool is_specialization_v = false;
+
+	template <template <class...> class U, class... Args>
+	inline constexpr bool is_specialization_v<U<Args...>, U> = true;
+
+	// bytes owned on the heap on top of sizeof(T), node and bucket overhead is estimated
+	template <class T>
+	std::size_t HeapBytes(const T& a_value)
+	{
+		if constexpr (std::is_same_v<T, std::string>) {
+			// payload only leaves the small string buffer past its capacity
+			return a_value.capacity() > std::string{}.capacity() ? a_value.capacity() + 1 : 0;
+		} else if constexpr (std::is_same_v<T, TimeStamp>) {
+			return HeapBytes(a_value.format);
+		} else if constexpr (std::is_same_v<T, Speech::Line>) {
+			return HeapBytes(a_value.line) + HeapBytes(a_value.voice);
+		} else if constexpr (std::is_same_v<T, Dialogue::Line>) {
+			return HeapBytes(static_cast<const Speech::Line&>(a_value)) + HeapBytes(a_value.name);
+		} else if constexpr (std::is_same_v<T, Dialogue>) {
+			return HeapBytes(a_value.locName) + HeapBytes(a_value.speakerName) + HeapBytes(a_value.playerName) + HeapBytes(a_value.timeAndLoc) + HeapBytes(a_value.dialogue);
+		} else if constexpr (std::is_same_v<T, Monologue>) {
+			return HeapBytes(a_value.locName) + HeapBytes(a_value.speakerName) + HeapBytes(a_value.line) + HeapBytes(a_value.hourMinTimeStamp);
+		} else if constexpr (std::is_same_v<T, Monologues>) {
+			return HeapBytes(a_value.monologues);
+		} else if constexpr (is_specialization_v<T, std::optional>) {
+			return a_value ? HeapBytes(*a_value) : 0;
+		} else if constexpr (is_specialization_v<T, std::pair>) {
+			return HeapBytes(a_value.first) + HeapBytes(a_value.second);
+		} else if constexpr (is_specialization_v<T, std::vector>) {
+			std::size_t bytes = a_value.capacity() * sizeof(typename T::value_type);
+			for (const auto& item : a_value) {
+				bytes += HeapBytes(item);
+			}
+			return bytes;
+		} else if constexpr (is_specialization_v<T, std::map>) {
+			// three links and two flags per tree node
+			std::size_t bytes = a_value.size() * (sizeof(typename T::value_type) + 4 * sizeof(void*));
+			for (const auto& [key, value] : a_value) {
+				bytes += HeapBytes(key) + HeapBytes(value);
+			}
+			return bytes;
+		} else if constexpr (requires { a_value.values(); a_value.bucket_count(); }) {
+			// ankerl maps, dense value vector + bucket array
+			return HeapBytes(a_value.values()) + a_value.bucket_count() * sizeof(typename T::bucket_type);
+		} else {
+			static_assert(std::is_trivially_copyable_v<T>, "HeapBytes: type owns memory but isn't accounted for");
+			return 0;
+		}
+	}
+
+	template <class T>
+	Usage Measure(const T& a_value)
+	{
+		std::size_t count = 1;
+		if constexpr (requires { a_value.size(); }) {
+			count = a_value.size();
+		} else if constexpr (is_specialization_v<T, std::optional>) {
+			count = a_value.has_value();
+		}
+		return { count, sizeof(T) + HeapBytes(a_value) };
+	}
+
+	class Report
+	{
+	public:
+		void Add(std::string_view a_name, const Usage& a_usage);
+
+		template <class T>
+		void Add(std::string_view a_name, const T& a_value)
+		{
+			Add(a_name, Measure(a_value));
+		}
+
+		Usage       GetTotal() const;
+		std::string ToString() const;
+
+		static std::string FormatBytes(std::size_t a_bytes);
+
+	private:
+		// members
+		std::vector<std::pair<std::string, Usage>> entries{};
+	};
+
+	// walks every subsystem, main thread only
+	Report Collect();
+	void   Log(std::string_view a_reason);
+
+	// last collected report, so Papyrus never walks the subsystems on the VM thread
+	class Manager : public REX::Singleton<Manager>
+	{
+	public:
+		std::string GetReport() const;
+		void        SetReport(std::string a_report);
+		void        QueueUpdate();  // collects on the main thread
+
+	private:
+		// members
+		mutable std::mutex lock;
+		std::string        report{ "Memory report not collected yet" };
+		std::atomic_bool   updateQueued{ false };
+	};
+}
@@ -1,17 +1,109 @@
 #include "NPCNameProvider.h"
+#include "MemoryReport.h"
 #include "NND_API.h"
+#include "Translation.h"
 
-const char* NPCNameProvider::GetName(RE::TESObjectREFR* ref) const
+std::string NPCNameProvider::ResolveName(RE::TESObjectREFR* a_ref) const
 {
 	if (NND) {
-		if (auto actor = ref->As<RE::Actor>(); actor) {
+		if (auto actor = a_ref->As<RE::Actor>(); actor) {
 			if (auto name = NND->GetName(actor, NND_API::NameContext::kDialogueHistory); !name.empty()) {
-				return name.data();
+				return std::string(name);
 			}
 		}
 	}
 
-	return ref->GetDisplayFullName();
+	return a_ref->GetDisplayFullName();
+}
+
+std::string NPCNameProvider::GetName(RE::TESObjectREFR* a_ref)
+{
+	// player can be renamed at any time
+	if (a_ref->IsPlayerRef()) {
+		return ResolveName(a_ref);
+	}
+
+	// talking activators and other non-actor speakers are kept apart, so GetName(FormID) only hits actors
+	if (!a_ref->Is(RE::FormType::ActorCharacter)) {
+		auto [it, inserted] = objectNames.try_emplace(a_ref->GetFormID());
+		if (inserted) {
+			it->second = ResolveName(a_ref);
+		}
+		return it->second;
+	}
+
+	auto [it, inserted] = names.try_emplace(a_ref->GetFormID());
+	if (inserted || !it->second) {
+		it->second = ResolveName(a_ref);
+	}
+
+	return *it->second;
+}
+
+std::optional<std::string> NPCNameProvider::GetName(RE::FormID a_formID)
+{
+	// only actors are cached here
+	if (const auto it = names.find(a_formID); it != names.end()) {
+		return it->second;
+	}
+
+	auto actor = RE::TESForm::LookupByID<RE::Actor>(a_formID);
+	if (!actor) {
+		names.emplace(a_formID, std::nullopt);
+		return std::nullopt;
+	}
+
+	return GetName(actor);
+}
+
+std::string NPCNameProvider::GetLocationName(RE::TESForm* a_cellOrLoc)
+{
+	if (!a_cellOrLoc) {
+		return "$DH_UnknownLocation"_T;
+	}
+
+	auto [it, inserted] = locationNames.try_emplace(a_cellOrLoc->GetFormID());
+	if (inserted) {
+		it->second = a_cellOrLoc->GetName();
+		if (it->second.empty()) {
+			it->second = "$DH_UnknownLocation"_T;
+		}
+	}
+
+	return it->second;
+}
+
+std::string NPCNameProvider::GetLocationName(RE::FormID a_formID)
+{
+	if (const auto it = locationNames.find(a_formID); it != locationNames.end()) {
+		return it->second;
+	}
+
+	if (auto cellOrLoc = RE::TESForm::LookupByID(a_formID)) {
+		return GetLocationName(cellOrLoc);
+	}
+
+	return locationNames.emplace(a_formID, "???").first->second;
+}
+
+void NPCNameProvider::InvalidateName(RE::FormID a_formID)
+{
+	names.erase(a_formID);
+	objectNames.erase(a_formID);
+}
+
+void NPCNameProvider::ClearCache()
+{
+	names.clear();
+	objectNames.clear();
+	locationNames.clear();
+}
+
+void NPCNameProvider::ReportMemory(MemoryReport::Report& a_report) const
+{
+	a_report.Add("NPCNameProvider::names", names);
+	a_report.Add("NPCNameProvider::objectNames", objectNames);
+	a_report.Add("NPCNameProvider::locationNames", locationNames);
 }
 
 void NPCNameProvider::RequestAPI()
@@ -2,13 +2,35 @@
 
 #include "NND_API.h"
 
+namespace MemoryReport
+{
+	class Report;
+}
+
+// names are cached by FormID, so resolution scales with unique actors and locations rather than history size
 class NPCNameProvider : public REX::Singleton<NPCNameProvider>
 {
 public:
-	const char* GetName(RE::TESObjectREFR* actor) const;
+	std::string                GetName(RE::TESObjectREFR* a_ref);
+	std::optional<std::string> GetName(RE::FormID a_formID);  // nullopt if the actor no longer exists
+
+	std::string GetLocationName(RE::TESForm* a_cellOrLoc);
+	std::string GetLocationName(RE::FormID a_formID);
+
+	void InvalidateName(RE::FormID a_formID);
+	void ClearCache();
+
+	void ReportMemory(MemoryReport::Report& a_report) const;
 
 	void RequestAPI();
 
 private:
+	std::string ResolveName(RE::TESObjectREFR* a_ref) const;
+
+	// members
 	NND_API::IVNND1* NND{ nullptr };
+
+	Map<RE::FormID, std::optional<std::string>> names;  // actors, nullopt if the FormID isn't one
+	Map<RE::FormID, std::string>                objectNames;
+	Map<RE::FormID, std::string>                locationNames;
 };
@@ -4,7 +4,6 @@
 #define NOMINMAX
 #define DIRECTINPUT_VERSION 0x0800
 #define IMGUI_DEFINE_MATH_OPERATORS
-#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
 
 #define MANAGER(T) T::Manager::GetSingleton()
 
@@ -12,7 +11,9 @@
 #include "REX/REX/Singleton.h"
 #include "SKSE/SKSE.h"
 
-#include <codecvt>
+#include <emmintrin.h>
+#include <future>
+#include <thread>
 #include <dxgi.h>
 #include <shlobj.h>
 #include <wrl/client.h>
@@ -1,5 +1,7 @@
 #include "Papyrus.h"
 
+#include "MemoryReport.h"
+#include "Profiler.h"
 #include "Settings.h"
 
 namespace Papyrus
@@ -9,6 +11,20 @@ namespace Papyrus
 		Settings::GetSingleton()->LoadMCMSettings();
 	}
 
+	// runs on the VM thread, returns the last report and collects a fresh one on the main thread
+	std::string GetMemoryReport(RE::TESQuest*)
+	{
+		const auto manager = MANAGER(MemoryReport);
+		manager->QueueUpdate();
+		return manager->GetReport();
+	}
+
+	// writes the trace without turning tracing off, the profiler waits out spans being written on other threads
+	void DumpTrace(RE::TESQuest*)
+	{
+		MANAGER(Profiler)->FlushTrace();
+	}
+
 	bool Register(RE::BSScript::IVirtualMachine* a_vm)
 	{
 		if (!a_vm) {
@@ -16,6 +32,8 @@ namespace Papyrus
 		}
 
 		a_vm->RegisterFunction("OnConfigClose", MCM, OnConfigClose);
+		a_vm->RegisterFunction("GetMemoryReport", MCM, GetMemoryReport);
+		a_vm->RegisterFunction("DumpTrace", MCM, DumpTrace);
 
 		logger::info("Registered {} class", MCM);
 
@@ -4,7 +4,9 @@ namespace Papyrus
 {
 	inline constexpr auto MCM = "DialogueHistory_MCM"sv;
 
-	void OnConfigClose(RE::TESQuest*);
+	void        OnConfigClose(RE::TESQuest*);
+	std::string GetMemoryReport(RE::TESQuest*);
+	void        DumpTrace(RE::TESQuest*);
 
 	bool Register(RE::BSScript::IVirtualMachine* a_vm);
 }
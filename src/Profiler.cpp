@@ -0,0 +1,238 @@
+#include "Profiler.h"
+
+#include "ImGui/Renderer.h"
+#include "ImGui/Util.h"
+
+namespace Profiler
+{
+	void Manager::LoadMCMSettings(const CSimpleIniA& a_ini)
+	{
+		showOverlay = a_ini.GetBoolValue("Settings", "bShowFrameStats", showOverlay);
+		frameBudget = static_cast<float>(a_ini.GetDoubleValue("Settings", "fFrameBudget", frameBudget));
+
+		SetTracing(a_ini.GetBoolValue("Settings", "bTraceSpans", IsTracing()));
+	}
+
+	void Manager::SetTracing(bool a_enable)
+	{
+		if (a_enable == IsTracing()) {
+			return;
+		}
+
+		if (a_enable) {
+			if (!spans) {
+				spans = std::make_unique<Span[]>(traceSize);
+			} else {
+				// the last session's writers were waited out when it was turned off
+				for (std::size_t i = 0; i < traceSize; i++) {
+					spans[i].sequence.store(0, std::memory_order_relaxed);
+				}
+			}
+			spanCount.store(0, std::memory_order_relaxed);
+			traceStart = std::chrono::steady_clock::now();
+			tracing.store(true);
+		} else {
+			// writers either see tracing off, or are counted and waited for before the ring is read
+			tracing.store(false);
+			while (writers.load() != 0) {
+				std::this_thread::yield();
+			}
+			DumpTrace();
+		}
+	}
+
+	void Manager::FlushTrace()
+	{
+		if (IsTracing()) {
+			SetTracing(false);
+			SetTracing(true);
+		}
+	}
+
+	void Manager::AddSpan(const char* a_name, std::chrono::steady_clock::time_point a_start, std::chrono::steady_clock::time_point a_end)
+	{
+		writers.fetch_add(1);
+		if (tracing.load()) {
+			const auto idx = spanCount.fetch_add(1, std::memory_order_relaxed);
+			const auto busy = idx * 2 + 1;
+
+			// a wrapped writer still on the slot, or already past it, drops this span
+			auto& span = spans[idx % traceSize];
+			auto  sequence = span.sequence.load(std::memory_order_relaxed);
+			if (sequence % 2 == 0 && sequence < busy && span.sequence.compare_exchange_strong(sequence, busy, std::memory_order_acquire)) {
+				span.name = a_name;
+				span.threadID = GetCurrentThreadId();
+				span.start = std::chrono::duration_cast<std::chrono::microseconds>(a_start - traceStart).count();
+				span.duration = std::chrono::duration_cast<std::chrono::microseconds>(a_end - a_start).count();
+				span.sequence.store(busy + 1, std::memory_order_release);
+			}
+		}
+		writers.fetch_sub(1, std::memory_order_release);
+	}
+
+	// only called with tracing off and no writers in flight
+	void Manager::DumpTrace()
+	{
+		const auto total = spanCount.load(std::memory_order_acquire);
+		const auto count = std::min<std::uint64_t>(total, traceSize);
+		if (count == 0) {
+			return;
+		}
+
+		auto path = logger::log_directory();
+		if (!path) {
+			return;
+		}
+		*path /= std::format("{}_Trace.json", Version::PROJECT);
+
+		std::string buffer;
+		buffer.reserve(count * 96);
+		buffer += R"({"traceEvents":[)";
+
+		// oldest first once the ring has wrapped, skipping slots whose writer dropped its span
+		const auto  first = total - count;
+		std::size_t written = 0;
+		for (auto idx = first; idx < total; idx++) {
+			const auto& span = spans[idx % traceSize];
+			if (span.sequence.load(std::memory_order_acquire) != idx * 2 + 2) {
+				continue;
+			}
+			std::format_to(std::back_inserter(buffer), R"({}{{"name":"{}","ph":"X","pid":1,"tid":{},"ts":{},"dur":{}}})",
+				written ? "," : "", span.name, span.threadID, span.start, span.duration);
+			written++;
+		}
+		buffer += "]}";
+
+		std::ofstream file(*path, std::ios::binary | std::ios::trunc);
+		file.write(buffer.data(), buffer.size());
+
+		logger::info("Wrote {} trace spans to {}", written, path->string());
+	}
+
+	const char* Manager::GetSectionName(SECTION a_section)
+	{
+		switch (a_section) {
+		case SECTION::kRender:
+			return "Render";
+		case SECTION::kLocalHistory:
+			return "Local History";
+		case SECTION::kGlobalHistory:
+			return "Global History";
+		case SECTION::kInput:
+			return "Input";
+		case SECTION::kCapture:
+			return "Capture";
+		default:
+			return "???";
+		}
+	}
+
+	void Manager::AddTime(SECTION a_section, std::int64_t a_microseconds)
+	{
+		// only track frames where our menus are drawn
+		if (!ImGui::Renderer::renderMenus.load()) {
+			return;
+		}
+
+		currentFrame[std::to_underlying(a_section)].fetch_add(a_microseconds, std::memory_order_relaxed);
+	}
+
+	void Manager::EndFrame()
+	{
+		std::array<float, std::to_underlying(SECTION::kTotal)> times{};
+		for (std::size_t i = 0; i < times.size(); i++) {
+			times[i] = currentFrame[i].exchange(0, std::memory_order_relaxed) / 1000.0f;
+			sectionHistory[i][historyOffset] = times[i];
+		}
+
+		// history draws are nested inside render
+		const float total = times[std::to_underlying(SECTION::kRender)] + times[std::to_underlying(SECTION::kInput)] + times[std::to_underlying(SECTION::kCapture)];
+
+		frameHistory[historyOffset] = total;
+		historyOffset = (historyOffset + 1) % historySize;
+		frameCount = std::min(frameCount + 1, historySize);
+
+		framesSinceLastLog++;
+
+		if (frameBudget > 0.0f && total > frameBudget && framesSinceLastLog >= historySize) {
+			framesSinceLastLog = 0;
+			logger::warn("Slow frame : {:.3f} ms (budget {:.3f} ms) | Render {:.3f} ms | Local History {:.3f} ms | Global History {:.3f} ms | Input {:.3f} ms | Capture {:.3f} ms",
+				total, frameBudget,
+				times[std::to_underlying(SECTION::kRender)],
+				times[std::to_underlying(SECTION::kLocalHistory)],
+				times[std::to_underlying(SECTION::kGlobalHistory)],
+				times[std::to_underlying(SECTION::kInput)],
+				times[std::to_underlying(SECTION::kCapture)]);
+		}
+	}
+
+	float Manager::GetAverage(SECTION a_section) const
+	{
+		if (frameCount == 0) {
+			return 0.0f;
+		}
+
+		const auto& history = sectionHistory[std::to_underlying(a_section)];
+		return std::accumulate(history.begin(), history.begin() + frameCount, 0.0f) / frameCount;
+	}
+
+	void Manager::Draw()
+	{
+		if (!showOverlay || frameCount == 0) {
+			return;
+		}
+
+		const auto maxTime = *std::max_element(frameHistory.begin(), frameHistory.begin() + frameCount);
+		const auto avgTime = std::accumulate(frameHistory.begin(), frameHistory.begin() + frameCount, 0.0f) / frameCount;
+		const auto lastTime = frameHistory[(historyOffset + historySize - 1) % historySize];
+
+		ImGui::SetNextWindowPos(ImGui::GetNativeViewportPos() + ImGui::GetStyle().WindowPadding);
+		ImGui::SetNextWindowBgAlpha(ImGui::GetStyle().Colors[ImGuiCol_WindowBg].w);
+
+		ImGui::Begin("##FrameStats", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoFocusOnAppearing);
+		{
+			ImGui::Text("%.3f ms (avg %.3f, max %.3f)", lastTime, avgTime, maxTime);
+
+			const auto width = ImGui::CalcTextSize("0").x * 40;
+			ImGui::PlotHistogram("##FrameTimes", frameHistory.data(), static_cast<int>(frameCount), frameCount < historySize ? 0 : static_cast<int>(historyOffset), nullptr, 0.0f, std::max(maxTime, frameBudget), ImVec2(width, width * 0.25f));
+
+			for (std::size_t i = 0; i < std::to_underlying(SECTION::kTotal); i++) {
+				const auto section = static_cast<SECTION>(i);
+				ImGui::Text("%s : %.3f ms", GetSectionName(section), GetAverage(section));
+			}
+		}
+		ImGui::End();
+	}
+
+	ScopedTimer::ScopedTimer(SECTION a_section) :
+		section(a_section),
+		start(std::chrono::steady_clock::now())
+	{}
+
+	ScopedTimer::~ScopedTimer()
+	{
+		const auto end = std::chrono::steady_clock::now();
+		const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+		const auto profiler = MANAGER(Profiler);
+		profiler->AddTime(section, elapsed.count());
+		if (Manager::IsTracing()) {
+			profiler->AddSpan(Manager::GetSectionName(section), start, end);
+		}
+	}
+
+	TraceSpan::TraceSpan(const char* a_name) :
+		name(a_name)
+	{
+		if (Manager::IsTracing()) {
+			start = std::chrono::steady_clock::now();
+		}
+	}
+
+	TraceSpan::~TraceSpan()
+	{
+		if (start && Manager::IsTracing()) {
+			MANAGER(Profiler)->AddSpan(name, *start, std::chrono::steady_clock::now());
+		}
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+namespace Profiler
+{
+	enum class SECTION
+	{
+		kRender,  // HUDMenu::PostDisplay, includes both history draws
+		kLocalHistory,
+		kGlobalHistory,
+		kInput,
+		kCapture,  // draining hooked dialogue into history
+
+		kTotal
+	};
+
+	class Manager : public REX::Singleton<Manager>
+	{
+	public:
+		void LoadMCMSettings(const CSimpleIniA& a_ini);
+
+		static const char* GetSectionName(SECTION a_section);
+
+		void AddTime(SECTION a_section, std::int64_t a_microseconds);
+		void EndFrame();
+		void Draw();
+
+		// spans are kept in a ring buffer and written as Chrome trace events when tracing is turned off, or flushed
+		static bool IsTracing() { return tracing.load(std::memory_order_relaxed); }
+		void        AddSpan(const char* a_name, std::chrono::steady_clock::time_point a_start, std::chrono::steady_clock::time_point a_end);
+		void        FlushTrace();  // writes the spans so far and starts a new trace
+
+	private:
+		struct Span
+		{
+			// 2 * index + 1 while written, 2 * index + 2 once done, so wrapped writers can't tear a slot
+			std::atomic<std::uint64_t> sequence{ 0 };
+			const char*                name{ nullptr };
+			std::uint32_t              threadID{ 0 };
+			std::int64_t               start{ 0 };     // us since trace start
+			std::int64_t               duration{ 0 };  // us
+		};
+
+		static constexpr std::size_t historySize{ 240 };
+		static constexpr std::size_t traceSize{ 1 << 16 };
+
+		void SetTracing(bool a_enable);
+		void DumpTrace();
+
+		float GetAverage(SECTION a_section) const;
+
+		// members
+		std::array<std::atomic<std::int64_t>, std::to_underlying(SECTION::kTotal)> currentFrame{};
+
+		std::array<std::array<float, historySize>, std::to_underlying(SECTION::kTotal)> sectionHistory{};
+		std::array<float, historySize>                                                    frameHistory{};
+		std::size_t                                                                       historyOffset{ 0 };
+		std::size_t                                                                       frameCount{ 0 };
+		std::size_t                                                                       framesSinceLastLog{ historySize };
+
+		bool  showOverlay{ false };
+		float frameBudget{ 2.0f };  // ms, 0 = disabled
+
+		static inline std::atomic_bool        tracing{ false };
+		std::unique_ptr<Span[]>               spans{};  // allocated when tracing is first enabled
+		std::atomic<std::uint64_t>            spanCount{ 0 };
+		std::atomic<std::uint32_t>            writers{ 0 };  // AddSpan calls in flight, waited out before dumping
+		std::chrono::steady_clock::time_point traceStart{};
+	};
+
+	class ScopedTimer
+	{
+	public:
+		explicit ScopedTimer(SECTION a_section);
+		~ScopedTimer();
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+	private:
+		// members
+		SECTION                               section;
+		std::chrono::steady_clock::time_point start;
+	};
+
+	// near free while tracing is off, the clock is only read when enabled
+	class TraceSpan
+	{
+	public:
+		explicit TraceSpan(const char* a_name);
+		~TraceSpan();
+
+		TraceSpan(const TraceSpan&) = delete;
+		TraceSpan& operator=(const TraceSpan&) = delete;
+
+	private:
+		// members
+		const char*                                          name;
+		std::optional<std::chrono::steady_clock::time_point> start;
+	};
+}
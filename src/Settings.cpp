@@ -1,11 +1,56 @@
 #include "Settings.h"
 
+#include "Capture.h"
 #include "Dialogue.h"
 #include "GlobalHistory.h"
 #include "Hotkeys.h"
 #include "ImGui/IconsFonts.h"
 #include "ImGui/Renderer.h"
+#include "InputRecorder.h"
 #include "LocalHistory.h"
+#include "Profiler.h"
+
+namespace
+{
+	// missing files stamp as empty, so deleting or restoring one is a change
+	FileFingerprint::TrackedFile StampFile(const std::filesystem::path& a_path)
+	{
+		FileFingerprint::TrackedFile file{ a_path };
+
+		std::error_code ec;
+		file.lastWriteTime = std::filesystem::last_write_time(a_path, ec);
+		if (ec) {
+			return { a_path };
+		}
+		file.size = std::filesystem::file_size(a_path, ec);
+		if (ec) {
+			return { a_path };
+		}
+
+		return file;
+	}
+}
+
+void FileFingerprint::TrackFiles(const std::vector<std::filesystem::path>& a_paths)
+{
+	trackedFiles.clear();
+	for (const auto& path : a_paths) {
+		trackedFiles.push_back(StampFile(path));
+	}
+}
+
+bool FileFingerprint::UpdateTrackedFiles()
+{
+	bool changed = false;
+	for (auto& file : trackedFiles) {
+		auto stamp = StampFile(file.path);
+		if (stamp.lastWriteTime != file.lastWriteTime || stamp.size != file.size) {
+			file = std::move(stamp);
+			changed = true;
+		}
+	}
+	return changed;
+}
 
 void Settings::LoadINI(const wchar_t* a_path, const INIFunc a_func, bool a_generate)
 {
@@ -27,6 +72,52 @@ void Settings::LoadINI(const wchar_t* a_defaultPath, const wchar_t* a_userPath,
 	LoadINI(a_userPath, a_func);
 }
 
+// returns true if the file, or a file it tracks, changed since a_fingerprint was taken. a_func only runs if the ini itself changed
+bool Settings::LoadINI(const wchar_t* a_path, FileFingerprint& a_fingerprint, INIFunc a_func)
+{
+	std::error_code ec;
+	const auto      lastWriteTime = std::filesystem::last_write_time(a_path, ec);
+	if (ec) {
+		return false;
+	}
+	const auto size = std::filesystem::file_size(a_path, ec);
+	if (ec) {
+		return false;
+	}
+
+	if (a_fingerprint.hash && a_fingerprint.lastWriteTime == lastWriteTime && a_fingerprint.size == size) {
+		return a_fingerprint.UpdateTrackedFiles();
+	}
+
+	std::ifstream file(a_path, std::ios::binary);
+	if (!file.good()) {
+		return false;
+	}
+
+	const std::string data{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+	const auto        hash = ankerl::unordered_dense::hash<std::string_view>{}(data);
+
+	a_fingerprint.lastWriteTime = lastWriteTime;
+	a_fingerprint.size = size;
+
+	if (a_fingerprint.hash == hash) {
+		return a_fingerprint.UpdateTrackedFiles();
+	}
+
+	a_fingerprint.hash = hash;
+
+	CSimpleIniA ini;
+	ini.SetUnicode();
+
+	if (ini.LoadData(data) < SI_OK) {
+		return false;
+	}
+
+	a_func(ini);
+
+	return true;
+}
+
 void Settings::Load(FileType type, INIFunc a_func, bool a_generate) const
 {
 	switch (type) {
@@ -47,6 +138,18 @@ void Settings::Load(FileType type, INIFunc a_func, bool a_generate) const
 	}
 }
 
+bool Settings::Load(FileType type, FileFingerprint& a_fingerprint, INIFunc a_func) const
+{
+	switch (type) {
+	case FileType::kFonts:
+		return LoadINI(fontsPath, a_fingerprint, a_func);
+	case FileType::kStyles:
+		return LoadINI(stylesPath, a_fingerprint, a_func);
+	default:
+		return false;
+	}
+}
+
 void Settings::Save(FileType type, INIFunc a_func, bool a_generate) const
 {
 	switch (type) {
@@ -64,14 +167,121 @@ void Settings::Save(FileType type, INIFunc a_func, bool a_generate) const
 	}
 }
 
+MCMSettings::MCMSettings(const CSimpleIniA& a_ini)
+{
+	CSimpleIniA::TNamesDepend sections;
+	a_ini.GetAllSections(sections);
+
+	for (const auto& section : sections) {
+		CSimpleIniA::TNamesDepend keys;
+		a_ini.GetAllKeys(section.pItem, keys);
+
+		for (const auto& key : keys) {
+			Value value;
+			// type from the key prefix
+			switch (key.pItem[0]) {
+			case 'b':
+				value = a_ini.GetBoolValue(section.pItem, key.pItem);
+				break;
+			case 'i':
+				value = static_cast<std::int64_t>(a_ini.GetLongValue(section.pItem, key.pItem));
+				break;
+			case 'f':
+				value = a_ini.GetDoubleValue(section.pItem, key.pItem);
+				break;
+			default:
+				value = std::string(a_ini.GetValue(section.pItem, key.pItem, ""));
+				break;
+			}
+			values.insert_or_assign(Key{ section.pItem, key.pItem }, std::move(value));
+		}
+	}
+}
+
+std::vector<MCMSettings::Key> MCMSettings::Diff(const MCMSettings& a_previous) const
+{
+	std::vector<Key> changes;
+
+	for (const auto& [key, value] : values) {
+		if (const auto it = a_previous.values.find(key); it == a_previous.values.end() || it->second != value) {
+			changes.push_back(key);
+		}
+	}
+	for (const auto& key : a_previous.values | std::views::keys) {
+		if (!values.contains(key)) {
+			changes.push_back(key);
+		}
+	}
+
+	return changes;
+}
+
 void Settings::LoadMCMSettings() const
 {
-	constexpr auto load_mcm_settings = [](auto& ini) {
-		MANAGER(Hotkeys)->LoadHotKeys(ini);
-		MANAGER(IconFont)->LoadMCMSettings(ini);       // button scheme
-		MANAGER(LocalHistory)->LoadMCMSettings(ini);   // menu
-		MANAGER(GlobalHistory)->LoadMCMSettings(ini);  // time format, menu
+	struct Listener
+	{
+		bool (*matches)(const MCMSettings::Key& a_key);
+		void (*load)(const CSimpleIniA& a_ini);
+	};
+
+	static constexpr auto is_any_of = [](const MCMSettings::Key& a_key, std::initializer_list<std::string_view> a_keys) {
+		return std::ranges::find(a_keys, a_key.second) != a_keys.end();
+	};
+
+	static constexpr std::array listeners{
+		Listener{
+			[](const MCMSettings::Key& a_key) { return a_key.first == "Controls"; },  // includes button scheme, for the cached key icons
+			[](const CSimpleIniA& a_ini) { MANAGER(Hotkeys)->LoadHotKeys(a_ini); } },
+		Listener{
+			[](const MCMSettings::Key& a_key) { return is_any_of(a_key, { "iButtonScheme" }); },
+			[](const CSimpleIniA& a_ini) { MANAGER(IconFont)->LoadMCMSettings(a_ini); } },
+		Listener{
+			[](const MCMSettings::Key& a_key) { return is_any_of(a_key, { "bUnpauseLocalHistory", "bBlurLocalHistory", "bHideButtonLocalHistory" }); },
+			[](const CSimpleIniA& a_ini) { MANAGER(LocalHistory)->LoadMCMSettings(a_ini); } },
+		Listener{
+			[](const MCMSettings::Key& a_key) {
+				return is_any_of(a_key, { "b12HourFormat", "bUnpauseGlobalHistory", "bBlurGlobalHistory", "bHideButtonGlobalHistory",
+											"bSceneDialogueConversationHistory", "bCombatDialogueConversationHistory", "bFavorDialogueConversationHistory",
+											"bDetectionDialogueConversationHistory", "bMiscDialogueConversationHistory" });
+			},
+			[](const CSimpleIniA& a_ini) { MANAGER(GlobalHistory)->LoadMCMSettings(a_ini); } },
+		Listener{
+			[](const MCMSettings::Key& a_key) { return is_any_of(a_key, { "bShowFrameStats", "fFrameBudget", "bTraceSpans" }); },
+			[](const CSimpleIniA& a_ini) { MANAGER(Profiler)->LoadMCMSettings(a_ini); } },
+		Listener{
+			[](const MCMSettings::Key& a_key) { return is_any_of(a_key, { "bRecordInput", "bReplayInput" }); },
+			[](const CSimpleIniA& a_ini) { MANAGER(InputRecorder)->LoadMCMSettings(a_ini); } },
+		Listener{
+			[](const MCMSettings::Key& a_key) { return is_any_of(a_key, { "bRecordCapture" }); },
+			[](const CSimpleIniA& a_ini) { MANAGER(Capture)->LoadMCMSettings(a_ini); } }
 	};
 
-	Load(FileType::kMCM, load_mcm_settings);
+	// user values replace the defaults
+	CSimpleIniA ini;
+	ini.SetUnicode();
+	(void)ini.LoadFile(defaultMCMPath);
+	(void)ini.LoadFile(userMCMPath);
+
+	MCMSettings settings(ini);
+
+	if (!lastMCMSettings) {
+		for (const auto& listener : listeners) {
+			listener.load(ini);
+		}
+	} else {
+		const auto changes = settings.Diff(*lastMCMSettings);
+		if (changes.empty()) {
+			return;
+		}
+
+		logger::info("{} MCM settings changed", changes.size());
+
+		for (const auto& listener : listeners) {
+			if (std::ranges::any_of(changes, listener.matches)) {
+				listener.load(ini);
+			}
+		}
+	}
+
+	lastMCMSettings = std::move(settings);
 }
@@ -8,6 +8,44 @@ enum class FileType
 	kDisplayTweaks,
 };
 
+// write time and size are checked first so unchanged files are never read, the content hash catches files that were saved without edits
+struct FileFingerprint
+{
+	// files the ini points to (fonts), a change to any of them counts as a change to the ini
+	struct TrackedFile
+	{
+		std::filesystem::path           path{};
+		std::filesystem::file_time_type lastWriteTime{};
+		std::uintmax_t                  size{ 0 };
+	};
+
+	void TrackFiles(const std::vector<std::filesystem::path>& a_paths);
+	bool UpdateTrackedFiles();  // true if a tracked file changed since it was last stamped
+
+	// members
+	std::filesystem::file_time_type lastWriteTime{};
+	std::uintmax_t                  size{ 0 };
+	std::optional<std::uint64_t>    hash{};
+	std::vector<TrackedFile>        trackedFiles{};
+};
+
+// typed copy of the merged MCM settings, diffed on config close so only the affected subsystems reload
+class MCMSettings
+{
+public:
+	using Key = std::pair<std::string, std::string>;  // section, key
+	using Value = std::variant<bool, std::int64_t, double, std::string>;
+
+	MCMSettings() = default;
+	explicit MCMSettings(const CSimpleIniA& a_ini);
+
+	std::vector<Key> Diff(const MCMSettings& a_previous) const;
+
+private:
+	// members
+	std::map<Key, Value> values{};
+};
+
 class Settings
 {
 public:
@@ -19,6 +57,7 @@ public:
 	}
 
 	void Load(FileType type, INIFunc a_func, bool a_generate = false) const;
+	bool Load(FileType type, FileFingerprint& a_fingerprint, INIFunc a_func) const;
 	void Save(FileType type, INIFunc a_func, bool a_generate = false) const;
 
 	void LoadMCMSettings() const;
@@ -26,6 +65,7 @@ public:
 private:
 	static void LoadINI(const wchar_t* a_path, INIFunc a_func, bool a_generate = false);
 	static void LoadINI(const wchar_t* a_defaultPath, const wchar_t* a_userPath, INIFunc a_func);
+	static bool LoadINI(const wchar_t* a_path, FileFingerprint& a_fingerprint, INIFunc a_func);
 
 	// members
 	const wchar_t* fontsPath{ L"Data/Interface/DialogueHistory/fonts.ini" };
@@ -37,6 +77,8 @@ private:
 	const wchar_t* defaultDisplayTweaksPath{ L"Data/SKSE/Plugins/SSEDisplayTweaks.ini" };
 	const wchar_t* userDisplayTweaksPath{ L"Data/SKSE/Plugins/SSEDisplayTweaks_Custom.ini" };
 
+	static inline std::optional<MCMSettings> lastMCMSettings{};
+
 	static Settings instance;
 };
 
@@ -0,0 +1,31 @@
+#pragma once
+
+// engine independent part of TimeStamp, history is keyed by the game date packed into decimal digits (YYYMMDDHHMM)
+namespace TimeStampKey
+{
+	constexpr std::uint64_t Generate(const std::tm& a_time)
+	{
+		return static_cast<std::uint64_t>(a_time.tm_year) * 100000000 +
+		       static_cast<std::uint64_t>(a_time.tm_mon) * 1000000 +
+		       static_cast<std::uint64_t>(a_time.tm_mday) * 10000 +
+		       static_cast<std::uint64_t>(a_time.tm_hour) * 100 +
+		       static_cast<std::uint64_t>(a_time.tm_min);
+	}
+
+	constexpr std::tm Extract(std::uint64_t a_timeStamp)
+	{
+		std::tm time{};
+
+		time.tm_min = a_timeStamp % 100;
+		a_timeStamp /= 100;
+		time.tm_hour = a_timeStamp % 100;
+		a_timeStamp /= 100;
+		time.tm_mday = a_timeStamp % 100;
+		a_timeStamp /= 100;
+		time.tm_mon = a_timeStamp % 100;
+		a_timeStamp /= 100;
+		time.tm_year = static_cast<int>(a_timeStamp);
+
+		return time;
+	}
+}
@@ -20,40 +20,51 @@ namespace Translation
 
 	bool Manager::LoadTranslation(const std::filesystem::path& a_path)
 	{
-		if (!std::filesystem::exists(a_path)) {
+		std::error_code ec;
+		if (!std::filesystem::exists(a_path, ec)) {
 			return false;
 		}
 
-		std::wfstream filestream(a_path, std::wfstream::in | std::wfstream::binary);
-		if (!filestream.good()) {
+		std::ifstream file(a_path, std::ios::binary | std::ios::ate);
+		if (!file.good()) {
 			return false;
 		} else {
 			logger::info("Reading translations from {}...", a_path.string());
 		}
 
-		filestream.imbue(std::locale(filestream.getloc(), new std::codecvt_utf16<wchar_t, 0x10FFFF, std::little_endian>));
+		// read the whole file at once
+		std::string buffer(static_cast<std::size_t>(file.tellg()), '\0');
+		file.seekg(0);
+		file.read(buffer.data(), buffer.size());
 
 		// check if the BOM is UTF-16
-		constexpr wchar_t BOM_UTF16LE = 0xFEFF;
-		if (filestream.get() != BOM_UTF16LE) {
+		if (!HasBOM(buffer)) {
 			logger::info("\tBOM Error, file must be encoded in UCS-2 LE.");
 			return false;
 		}
 
-		std::wstring line, key, value;
-
-		while (std::getline(filestream, line)) {
-			std::wstringstream ss(line);
-			ss >> key;
-			// remove leading whitespace
-			std::getline(ss >> std::ws, value);
-			// remove space/new line at end
-			if (std::isspace(value.back())) {
-				value.pop_back();
-			}
-			translationMap.emplace(*stl::utf16_to_utf8(key), *stl::utf16_to_utf8(value));
+		// single conversion, lines are then tokenized in place
+		const auto contents = UTF16ToUTF8(std::string_view(buffer).substr(2));
+		if (!contents) {
+			logger::info("\tFailed to convert file to UTF-8.");
+			return false;
 		}
 
+		ForEachEntry(*contents, [this](std::string_view a_key, std::string_view a_value) {
+			AddTranslation(a_key, a_value);
+		});
+
 		return true;
 	}
+
+	void Manager::AddTranslation(std::string_view a_key, std::string_view a_value)
+	{
+		if (const auto index = FindKey(a_key)) {
+			if (auto& translation = translations[*index]; translation.empty()) {
+				translation = a_value;
+			}
+		} else {
+			translationMap.emplace(a_key, a_value);
+		}
+	}
 }
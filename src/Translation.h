@@ -1,5 +1,7 @@
 #pragma once
 
+#include "TranslationTable.h"
+
 namespace Translation
 {
 	class Manager final : public REX::Singleton<Manager>
@@ -10,26 +12,48 @@ namespace Translation
 		void BuildTranslationMap();
 		bool LoadTranslation(const std::filesystem::path& a_path);
 
+		const std::string& GetTranslation(std::size_t a_index) const
+		{
+			if (const auto& str = translations[a_index]; !str.empty()) {
+				return str;
+			}
+			return failed;
+		}
+
+		// keys only known at runtime
 		template <class T>
-		const std::string& GetTranslation(const T& a_key)
+		const std::string& GetTranslation(const T& a_key) const
 		{
-			if (const auto it = translationMap.find(a_key); it != translationMap.end()) {
-				return it->second;
+			const std::string_view key(a_key);
+			if (const auto index = FindKey(key)) {
+				return GetTranslation(*index);
 			}
 
-			static std::string str = "TRANSLATION FAILED";
-			return str;
+			if (const auto it = translationMap.find(key); it != translationMap.end()) {
+				return it->second;
+			}
+			return failed;
 		}
 
 	private:
-		StringMap<std::string> translationMap{};
+		static inline const std::string failed{ "TRANSLATION FAILED" };
+
+		void AddTranslation(std::string_view a_key, std::string_view a_value);
+
+		// members
+		std::array<std::string, keys.size()> translations{};
+		StringMap<std::string>               translationMap{};  // keys not used in code
 	};
 }
 
 #define TRANSLATE(STR) Translation::Manager::GetSingleton()->GetTranslation(STR).c_str()
 #define TRANSLATE_S(STR) Translation::Manager::GetSingleton()->GetTranslation(STR)
 
-constexpr const char* operator""_T(const char* str, std::size_t)
+template <Translation::Key K>
+const char* operator""_T()
 {
-	return Translation::Manager::GetSingleton()->GetTranslation(str).c_str();
+	constexpr auto index = Translation::FindKey(K.view());
+	static_assert(index.has_value(), "unknown translation key, add it to Translation::keys");
+
+	return Translation::Manager::GetSingleton()->GetTranslation(*index).c_str();
 }
@@ -0,0 +1,189 @@
+#pragma once
+
+// engine independent parts of Translation: the key table, the file decoder and tokenizer
+namespace Translation
+{
+	// keys used in code, resolved to a dense index at compile time so lookups don't hash at runtime
+	inline constexpr std::array keys{
+		"$DH_Title"sv,
+		"$DH_Title_Conversation"sv,
+		"$DH_Exit_Button"sv,
+		"$DH_Name_Text"sv,
+		"$DH_Date_Text"sv,
+		"$DH_Location_Text"sv,
+		"$DH_ReplayConversation_Button"sv,
+		"$DH_UnknownLocation"sv
+	};
+
+	constexpr std::uint64_t HashKey(std::string_view a_key)
+	{
+		// FNV-1a
+		std::uint64_t hash = 14695981039346656037ull;
+		for (const auto c : a_key) {
+			hash ^= static_cast<std::uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	inline constexpr auto keyHashes = [] {
+		std::array<std::uint64_t, keys.size()> hashes{};
+		for (std::size_t i = 0; i < keys.size(); i++) {
+			hashes[i] = HashKey(keys[i]);
+		}
+		return hashes;
+	}();
+
+	static_assert([] {
+		for (std::size_t i = 0; i < keyHashes.size(); i++) {
+			for (std::size_t j = i + 1; j < keyHashes.size(); j++) {
+				if (keyHashes[i] == keyHashes[j]) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}(), "duplicate translation key");
+
+	constexpr std::optional<std::size_t> FindKey(std::string_view a_key)
+	{
+		const auto hash = HashKey(a_key);
+		for (std::size_t i = 0; i < keyHashes.size(); i++) {
+			if (keyHashes[i] == hash && keys[i] == a_key) {
+				return i;
+			}
+		}
+		return std::nullopt;
+	}
+
+	template <std::size_t N>
+	struct Key
+	{
+		consteval Key(const char (&a_str)[N])
+		{
+			std::copy_n(a_str, N, str);
+		}
+
+		constexpr std::string_view view() const { return { str, N - 1 }; }
+
+		// members
+		char str[N]{};
+	};
+
+	constexpr bool HasBOM(std::string_view a_bytes)
+	{
+		return a_bytes.size() >= 2 && a_bytes[0] == '\xFF' && a_bytes[1] == '\xFE';
+	}
+
+	// UTF-16 LE bytes to UTF-8, std::nullopt on an odd size or an unpaired surrogate.
+	// One pass into a buffer sized for the worst case (3 bytes a unit), ASCII runs are narrowed 8 units at a time
+	inline std::optional<std::string> UTF16ToUTF8(std::string_view a_bytes)
+	{
+		if (a_bytes.size() % 2 != 0) {
+			return std::nullopt;
+		}
+
+		const auto unit_at = [&](std::size_t a_index) -> char32_t {
+			return static_cast<std::uint8_t>(a_bytes[a_index * 2]) | static_cast<std::uint8_t>(a_bytes[a_index * 2 + 1]) << 8;
+		};
+
+		const auto count = a_bytes.size() / 2;
+
+		std::string result;
+		bool        valid = true;
+
+		result.resize_and_overwrite(count * 3, [&](char* a_buffer, std::size_t) {
+			auto out = a_buffer;
+#if defined(_M_X64) || defined(__SSE2__)
+			const auto asciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+#endif
+
+			std::size_t i = 0;
+			while (i < count) {
+#if defined(_M_X64) || defined(__SSE2__)
+				while (i + 8 <= count) {
+					const auto units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_bytes.data() + i * 2));
+					if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, asciiMask), _mm_setzero_si128())) != 0xFFFF) {
+						break;
+					}
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(units, units));
+					out += 8;
+					i += 8;
+				}
+				if (i == count) {
+					break;
+				}
+#endif
+				auto codePoint = unit_at(i++);
+				if (codePoint >= 0xD800 && codePoint < 0xDC00) {
+					const auto low = i < count ? unit_at(i) : char32_t{ 0 };
+					if (low < 0xDC00 || low >= 0xE000) {
+						valid = false;
+						return std::size_t{ 0 };
+					}
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+					i++;
+				} else if (codePoint >= 0xDC00 && codePoint < 0xE000) {
+					valid = false;
+					return std::size_t{ 0 };
+				}
+
+				if (codePoint < 0x80) {
+					*out++ = static_cast<char>(codePoint);
+				} else if (codePoint < 0x800) {
+					*out++ = static_cast<char>(0xC0 | (codePoint >> 6));
+					*out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+				} else if (codePoint < 0x10000) {
+					*out++ = static_cast<char>(0xE0 | (codePoint >> 12));
+					*out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+					*out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+				} else {
+					*out++ = static_cast<char>(0xF0 | (codePoint >> 18));
+					*out++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+					*out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+					*out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+				}
+			}
+
+			return static_cast<std::size_t>(out - a_buffer);
+		});
+
+		if (!valid) {
+			return std::nullopt;
+		}
+		return result;
+	}
+
+	// calls a_func(key, value) for each "key<whitespace>value" line of the UTF-8 contents, blank lines are skipped.
+	// Views point into a_contents
+	template <class F>
+	void ForEachEntry(std::string_view a_contents, F&& a_func)
+	{
+		constexpr auto whitespace = " \t\n\v\f\r"sv;
+
+		while (!a_contents.empty()) {
+			const auto eol = a_contents.find('\n');
+			auto       line = a_contents.substr(0, eol);
+			a_contents.remove_prefix(eol == std::string_view::npos ? a_contents.size() : eol + 1);
+
+			const auto keyStart = line.find_first_not_of(whitespace);
+			if (keyStart == std::string_view::npos) {
+				continue;
+			}
+			line.remove_prefix(keyStart);
+
+			const auto keyEnd = line.find_first_of(whitespace);
+			const auto key = line.substr(0, keyEnd);
+
+			auto value = keyEnd == std::string_view::npos ? ""sv : line.substr(keyEnd);
+			// remove leading whitespace
+			value.remove_prefix(std::min(value.find_first_not_of(whitespace), value.size()));
+			// remove space/new line at end
+			if (!value.empty() && whitespace.contains(value.back())) {
+				value.remove_suffix(1);
+			}
+
+			a_func(key, value);
+		}
+	}
+}
@@ -0,0 +1,90 @@
+#include "Voice.h"
+
+#include "Dialogue.h"
+
+#undef GetObject
+
+namespace Voice
+{
+	SoundID EngineBackend::Build(const std::string& a_path)
+	{
+		RE::BSResource::ID file;
+		file.GenerateFromPath(a_path.c_str());
+
+		RE::BSSoundHandle handle;
+		RE::BSAudioManager::GetSingleton()->BuildSoundDataFromFile(handle, file, 128 | 0x10, 128);
+		if (!handle.IsValid()) {
+			return 0;
+		}
+
+		auto soundOutput = RE::BGSDefaultObjectManager::GetSingleton()->GetObject<RE::BGSSoundOutput>(RE::DEFAULT_OBJECTS::kDialogueOutputModel2D);
+		if (soundOutput) {
+			handle.SetOutputModel(soundOutput);
+		}
+
+		const auto id = nextID++;
+		handles.emplace(id, handle);
+
+		return id;
+	}
+
+	void EngineBackend::Play(SoundID a_sound)
+	{
+		if (const auto it = handles.find(a_sound); it != handles.end()) {
+			it->second.Play();
+		}
+	}
+
+	bool EngineBackend::IsPlaying(SoundID a_sound) const
+	{
+		const auto it = handles.find(a_sound);
+		return it != handles.end() && it->second.IsPlaying();
+	}
+
+	void EngineBackend::Release(SoundID a_sound)
+	{
+		const auto it = handles.find(a_sound);
+		if (it == handles.end()) {
+			return;
+		}
+
+		auto& handle = it->second;
+		if (handle.IsPlaying()) {
+			handle.FadeOutAndRelease(500);
+		} else if (handle.IsValid()) {
+			handle.Stop();
+		}
+		handles.erase(it);
+	}
+
+	void Manager::Prefetch(const std::string& a_voice)
+	{
+		player.Hover(a_voice, Player::clock::now());
+	}
+
+	void Manager::Play(const std::string& a_voice)
+	{
+		player.Play(a_voice);
+	}
+
+	void Manager::PlayConversation(const Dialogue& a_dialogue)
+	{
+		std::vector<std::string> voices;
+		voices.reserve(a_dialogue.dialogue.size());
+		for (const auto& line : a_dialogue.dialogue) {
+			voices.push_back(line.voice);
+		}
+
+		player.PlayConversation(std::move(voices));
+	}
+
+	void Manager::Update()
+	{
+		player.Update(Player::clock::now());
+	}
+
+	void Manager::Reset()
+	{
+		player.Reset();
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "VoicePlayer.h"
+
+struct Dialogue;
+
+namespace Voice
+{
+	// BSSoundHandles behind sound ids
+	class EngineBackend : public IVoiceBackend
+	{
+	public:
+		SoundID Build(const std::string& a_path) override;
+		void    Play(SoundID a_sound) override;
+		bool    IsPlaying(SoundID a_sound) const override;
+		void    Release(SoundID a_sound) override;
+
+	private:
+		// members
+		Map<SoundID, RE::BSSoundHandle> handles{};
+		SoundID                         nextID{ 1 };
+	};
+
+	// sounds are built ahead of time (hovered line, next queued line) so playback doesn't stall on BSA reads
+	class Manager : public REX::Singleton<Manager>
+	{
+	public:
+		void Prefetch(const std::string& a_voice);  // every frame the line is hovered
+		void Play(const std::string& a_voice);
+		void PlayConversation(const Dialogue& a_dialogue);
+
+		void Update();
+		void Reset();  // drops queued and prefetched lines, fades out the current one
+
+	private:
+		// members
+		EngineBackend backend{};
+		Player        player{ backend };
+	};
+}
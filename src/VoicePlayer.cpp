@@ -0,0 +1,137 @@
+#include "VoicePlayer.h"
+
+namespace Voice
+{
+	Player::Player(IVoiceBackend& a_backend) :
+		backend(a_backend)
+	{}
+
+	void Player::Build(Sound& a_sound, const std::string& a_voice)
+	{
+		Release(a_sound);
+
+		a_sound.path = a_voice;
+		a_sound.id = backend.Build(a_voice);
+	}
+
+	void Player::Release(Sound& a_sound)
+	{
+		if (a_sound.id != 0) {
+			backend.Release(a_sound.id);
+		}
+		a_sound = {};
+	}
+
+	bool Player::IsFinished(Sound& a_sound, clock::time_point a_now) const
+	{
+		if (a_sound.id == 0) {
+			return true;
+		}
+
+		if (backend.IsPlaying(a_sound.id)) {
+			a_sound.started = true;
+			return false;
+		}
+
+		// give up on lines that never start
+		return a_sound.started || a_now - a_sound.playTime > startTimeout;
+	}
+
+	void Player::Hover(const std::string& a_voice, clock::time_point a_now)
+	{
+		if (a_voice.empty()) {
+			return;
+		}
+
+		if (a_voice != hovered) {
+			hovered = a_voice;
+			hoverTime = a_now;
+		}
+		hoveredThisFrame = true;
+	}
+
+	// lines start on the next Update, so a click never adds a build to the frame that drew it
+	void Player::Play(const std::string& a_voice)
+	{
+		if (a_voice.empty()) {
+			return;
+		}
+
+		queue.clear();
+		queue.push_back(a_voice);
+		Release(current);
+	}
+
+	void Player::PlayConversation(std::vector<std::string> a_voices)
+	{
+		queue.clear();
+		for (auto& voice : a_voices) {
+			if (!voice.empty()) {
+				queue.push_back(std::move(voice));
+			}
+		}
+
+		if (!queue.empty()) {
+			Release(current);
+		}
+	}
+
+	void Player::StartPlayback(const std::string& a_voice, clock::time_point a_now)
+	{
+		Release(current);
+
+		if (prefetched.path == a_voice) {
+			current = std::exchange(prefetched, {});
+		} else {
+			Build(current, a_voice);
+		}
+
+		if (current.id == 0) {
+			return;
+		}
+
+		backend.Play(current.id);
+		current.playTime = a_now;
+	}
+
+	void Player::Update(clock::time_point a_now)
+	{
+		// hover only lasts as long as the line keeps getting reported
+		if (!hoveredThisFrame) {
+			hovered.clear();
+		}
+
+		hoveredThisFrame = false;
+
+		// at most one build per frame, starting the next line comes first
+		if (!queue.empty() && IsFinished(current, a_now)) {
+			auto voice = std::move(queue.front());
+			queue.pop_front();
+
+			const bool wasPrefetched = voice == prefetched.path;
+			StartPlayback(voice, a_now);
+			if (!wasPrefetched) {
+				return;
+			}
+		}
+
+		// queued lines own the prefetch slot while a conversation replays
+		if (!queue.empty()) {
+			if (queue.front() != prefetched.path) {
+				Build(prefetched, queue.front());
+			}
+		} else if (!hovered.empty() && hovered != prefetched.path && hovered != current.path && a_now - hoverTime >= hoverDelay) {
+			Build(prefetched, hovered);
+		}
+	}
+
+	void Player::Reset()
+	{
+		queue.clear();
+		Release(prefetched);
+		Release(current);
+
+		hovered.clear();
+		hoveredThisFrame = false;
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+namespace Voice
+{
+	using SoundID = std::uint32_t;  // 0 if none
+
+	// the engine sound calls the player needs, stubbed in tests
+	class IVoiceBackend
+	{
+	public:
+		virtual ~IVoiceBackend() = default;
+
+		virtual SoundID Build(const std::string& a_path) = 0;  // reads the file, 0 on failure
+		virtual void    Play(SoundID a_sound) = 0;
+		virtual bool    IsPlaying(SoundID a_sound) const = 0;
+		virtual void    Release(SoundID a_sound) = 0;  // fades out if playing
+	};
+
+	// current line, one prefetched line and the conversation queue. Builds read the file and are the slow part,
+	// so only Update builds, at most once per frame, and hovered lines wait for the hover to settle.
+	// Sounds are released through Reset, never on destruction: the player outlives the audio manager at exit
+	class Player
+	{
+	public:
+		using clock = std::chrono::steady_clock;
+
+		static constexpr auto hoverDelay = std::chrono::milliseconds(150);
+		static constexpr auto startTimeout = std::chrono::seconds(1);
+
+		Player() = delete;
+		explicit Player(IVoiceBackend& a_backend);
+		~Player() = default;
+
+		void Hover(const std::string& a_voice, clock::time_point a_now);  // every frame the line is hovered
+		void Play(const std::string& a_voice);
+		void PlayConversation(std::vector<std::string> a_voices);
+
+		void Update(clock::time_point a_now);  // once per frame
+		void Reset();                          // drops queued and prefetched lines, fades out the current one
+
+		const std::string& GetCurrent() const { return current.path; }
+		const std::string& GetPrefetched() const { return prefetched.path; }
+		std::size_t        GetQueueSize() const { return queue.size(); }
+
+	private:
+		struct Sound
+		{
+			// members
+			std::string       path{};
+			SoundID           id{ 0 };  // kept at 0 on failure, so a missing file isn't rebuilt every frame
+			bool              started{ false };
+			clock::time_point playTime{};
+		};
+
+		void Build(Sound& a_sound, const std::string& a_voice);
+		void Release(Sound& a_sound);
+		bool IsFinished(Sound& a_sound, clock::time_point a_now) const;
+
+		void StartPlayback(const std::string& a_voice, clock::time_point a_now);
+
+		// members
+		IVoiceBackend&          backend;
+		Sound                   current{};
+		Sound                   prefetched{};
+		std::deque<std::string> queue{};
+		std::string             hovered{};
+		clock::time_point       hoverTime{};
+		bool                    hoveredThisFrame{ false };
+	};
+}
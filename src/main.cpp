@@ -1,3 +1,4 @@
+#include "Capture.h"
 #include "GlobalHistory.h"
 #include "Hooks.h"
 #include "ImGui/Renderer.h"
@@ -5,7 +6,9 @@
 #include "LocalHistory.h"
 #include "NPCNameProvider.h"
 #include "Papyrus.h"
+#include "Profiler.h"
 #include "Settings.h"
+#include "Voice.h"
 
 void OnInit(SKSE::MessagingInterface::Message* a_msg)
 {
@@ -25,15 +28,24 @@ void OnInit(SKSE::MessagingInterface::Message* a_msg)
 		break;
 	case SKSE::MessagingInterface::kDataLoaded:
 		{
+			Profiler::TraceSpan span("DataLoaded");
+
 			logger::info("{:*^50}", "DATA LOADED");
+			MANAGER(Capture)->Register();
 			MANAGER(LocalHistory)->Register();
 			MANAGER(GlobalHistory)->Register();
 
 			PhotoMode::activeGlobal = RE::TESForm::LookupByEditorID<RE::TESGlobal>("PhotoMode_IsActive");
-			MANAGER(Translation)->BuildTranslationMap();
+			{
+				Profiler::TraceSpan translationSpan("BuildTranslationMap");
+				MANAGER(Translation)->BuildTranslationMap();
+			}
 
 			logger::info("{:*^50}", "FILE CLEANUP");
-			MANAGER(GlobalHistory)->CleanupSavedFiles();
+			{
+				Profiler::TraceSpan cleanupSpan("CleanupSavedFiles");
+				MANAGER(GlobalHistory)->CleanupSavedFiles();
+			}
 		}
 		break;
 	case SKSE::MessagingInterface::kSaveGame:
@@ -48,6 +60,10 @@ void OnInit(SKSE::MessagingInterface::Message* a_msg)
 			string::replace_last_instance(savePath, ".ess", "");
 
 			logger::info("{:*^50}", "LOAD GAME");
+			MANAGER(Capture)->RecordEvent(Capture::Session::EVENT::kLoad);
+			MANAGER(Capture)->Clear();
+			MANAGER(Voice)->Reset();
+			NPCNameProvider::GetSingleton()->ClearCache();
 			MANAGER(GlobalHistory)->LoadFiles(savePath);
 		}
 		break;
@@ -58,6 +74,10 @@ void OnInit(SKSE::MessagingInterface::Message* a_msg)
 		}
 		break;
 	case SKSE::MessagingInterface::kNewGame:
+		MANAGER(Capture)->RecordEvent(Capture::Session::EVENT::kNewGame);
+		MANAGER(Capture)->Clear();
+		MANAGER(Voice)->Reset();
+		NPCNameProvider::GetSingleton()->ClearCache();
 		MANAGER(GlobalHistory)->Clear();
 		break;
 	default:
@@ -128,6 +148,12 @@ extern "C" DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::LoadInterface* a_s
 
 	SKSE::Init(a_skse, false);
 
+	// read early so plugin load can be traced
+	Settings::GetSingleton()->Load(FileType::kMCM, [](auto& ini) {
+		MANAGER(Profiler)->LoadMCMSettings(ini);
+	});
+	Profiler::TraceSpan span("SKSEPlugin_Load");
+
 	Settings::GetSingleton()->Load(FileType::kDisplayTweaks, [](auto& ini) {
 		DisplayTweaks::LoadSettings(ini);  // display tweaks scaling
 	});
@@ -0,0 +1,113 @@
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace AllocationCounter
+{
+	static constexpr std::size_t header = alignof(std::max_align_t);  // holds the size, so frees can be counted
+
+	static std::atomic<std::size_t> count{ 0 };
+	static std::atomic<std::size_t> liveBytes{ 0 };
+	static std::atomic<std::size_t> peakBytes{ 0 };
+
+	std::size_t Get()
+	{
+		return count.load(std::memory_order_relaxed);
+	}
+
+	std::size_t GetLiveBytes()
+	{
+		return liveBytes.load(std::memory_order_relaxed);
+	}
+
+	std::size_t GetPeakBytes()
+	{
+		return peakBytes.load(std::memory_order_relaxed);
+	}
+
+	void ResetPeakBytes()
+	{
+		peakBytes.store(GetLiveBytes(), std::memory_order_relaxed);
+	}
+
+	static void* Allocate(std::size_t a_size) noexcept
+	{
+		const auto block = static_cast<char*>(std::malloc(a_size + header));
+		if (!block) {
+			return nullptr;
+		}
+		*reinterpret_cast<std::size_t*>(block) = a_size;
+
+		count.fetch_add(1, std::memory_order_relaxed);
+
+		const auto live = liveBytes.fetch_add(a_size, std::memory_order_relaxed) + a_size;
+		auto       peak = peakBytes.load(std::memory_order_relaxed);
+		while (live > peak && !peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+
+		return block + header;
+	}
+
+	static void Free(void* a_ptr) noexcept
+	{
+		if (!a_ptr) {
+			return;
+		}
+		const auto block = static_cast<char*>(a_ptr) - header;
+		liveBytes.fetch_sub(*reinterpret_cast<std::size_t*>(block), std::memory_order_relaxed);
+		std::free(block);
+	}
+}
+
+void* operator new(std::size_t a_size)
+{
+	if (auto ptr = AllocationCounter::Allocate(a_size)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t a_size)
+{
+	return ::operator new(a_size);
+}
+
+void* operator new(std::size_t a_size, const std::nothrow_t&) noexcept
+{
+	return AllocationCounter::Allocate(a_size);
+}
+
+void* operator new[](std::size_t a_size, const std::nothrow_t&) noexcept
+{
+	return AllocationCounter::Allocate(a_size);
+}
+
+void operator delete(void* a_ptr) noexcept
+{
+	AllocationCounter::Free(a_ptr);
+}
+
+void operator delete[](void* a_ptr) noexcept
+{
+	AllocationCounter::Free(a_ptr);
+}
+
+void operator delete(void* a_ptr, std::size_t) noexcept
+{
+	AllocationCounter::Free(a_ptr);
+}
+
+void operator delete[](void* a_ptr, std::size_t) noexcept
+{
+	AllocationCounter::Free(a_ptr);
+}
+
+void operator delete(void* a_ptr, const std::nothrow_t&) noexcept
+{
+	AllocationCounter::Free(a_ptr);
+}
+
+void operator delete[](void* a_ptr, const std::nothrow_t&) noexcept
+{
+	AllocationCounter::Free(a_ptr);
+}
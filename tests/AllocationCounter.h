@@ -0,0 +1,28 @@
+#pragma once
+
+// replaces the global operator new of the executable it is linked into, so tests can count heap allocations.
+// ImGuiHarness routes ImGui's allocator through it as well
+namespace AllocationCounter
+{
+	std::size_t Get();
+
+	// heap bytes held by live allocations, and their peak since the last reset
+	std::size_t GetLiveBytes();
+	std::size_t GetPeakBytes();
+	void        ResetPeakBytes();
+
+	// allocations made while a scope is alive
+	class Scope
+	{
+	public:
+		Scope() :
+			start(Get())
+		{}
+
+		std::size_t GetCount() const { return Get() - start; }
+
+	private:
+		// members
+		std::size_t start;
+	};
+}
@@ -0,0 +1,114 @@
+#include "CapturePipeline.h"
+
+#include <benchmark/benchmark.h>
+
+// a crowded city scene: every frame a_npcs townsfolk finish a line, some reported twice, while a few subtitles show,
+// pushed into the capture pipeline and drained into a sink. The any_of dedupe is the pairwise check the sort replaced
+namespace
+{
+	using namespace Capture;
+
+	// guards and merchants share a small pool of lines, every fourth one is reported twice
+	std::vector<TopicEnd> MakeCrowd(std::size_t a_npcs)
+	{
+		std::mt19937                                 rng(1);
+		std::uniform_int_distribution<std::uint32_t> line(0, 31);
+
+		std::vector<TopicEnd> topics;
+		for (std::uint32_t npc = 0; npc < a_npcs; npc++) {
+			const TopicEnd topic{ .speaker = 0x1000 + npc, .topicInfo = 0x2000 + line(rng) };
+			topics.push_back(topic);
+			if (npc % 4 == 0) {
+				topics.push_back(topic);
+			}
+		}
+		std::ranges::shuffle(topics, rng);
+		return topics;
+	}
+
+	// the lines AddConversations would look up
+	class CountingSink : public ISink
+	{
+	public:
+		void AddPlayerLine(std::string_view) override { lines++; }
+		void AddSpeakerLine(std::uint32_t, std::string_view, std::string_view) override { lines++; }
+		void AddConversations(std::span<const TopicEnd> a_topics) override { lines += a_topics.size(); }
+
+		// members
+		std::size_t lines{ 0 };
+	};
+
+	std::size_t CountUniqueAnyOf(std::span<const TopicEnd> a_topics)
+	{
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < a_topics.size(); i++) {
+			const auto& topic = a_topics[i];
+			if (std::any_of(a_topics.begin(), a_topics.begin() + i, [&](const auto& a_topic) { return a_topic.topicInfo == topic.topicInfo && a_topic.speaker == topic.speaker; })) {
+				continue;
+			}
+			count++;
+		}
+		return count;
+	}
+
+	void BM_RemoveDuplicateTopics(benchmark::State& a_state)
+	{
+		const auto crowd = MakeCrowd(static_cast<std::size_t>(a_state.range(0)));
+
+		std::vector<TopicEnd> topics;
+		TopicKeys             keys;
+		for (auto _ : a_state) {
+			topics.assign(crowd.begin(), crowd.end());
+			RemoveDuplicateTopics(topics, keys);
+			benchmark::DoNotOptimize(topics.size());
+		}
+		a_state.SetItemsProcessed(static_cast<std::int64_t>(a_state.iterations() * crowd.size()));
+	}
+
+	void BM_RemoveDuplicateTopicsAnyOf(benchmark::State& a_state)
+	{
+		const auto crowd = MakeCrowd(static_cast<std::size_t>(a_state.range(0)));
+
+		std::vector<TopicEnd> topics;
+		for (auto _ : a_state) {
+			topics.assign(crowd.begin(), crowd.end());
+			benchmark::DoNotOptimize(CountUniqueAnyOf(topics));
+		}
+		a_state.SetItemsProcessed(static_cast<std::int64_t>(a_state.iterations() * crowd.size()));
+	}
+
+	// one frame per iteration, everything the hooks push for a_npcs speakers and the drain after
+	void BM_CrowdedCity(benchmark::State& a_state)
+	{
+		const auto crowd = MakeCrowd(static_cast<std::size_t>(a_state.range(0)));
+
+		std::vector<Record> records;
+		for (std::size_t i = 0; i < crowd.size(); i++) {
+			records.push_back({ .type = TYPE::kTopicEnd, .speaker = crowd[i].speaker, .topicInfo = crowd[i].topicInfo });
+			if (i % 8 == 0) {
+				auto& subtitle = records.emplace_back(Record{ .type = TYPE::kSpeakerLine, .speaker = crowd[i].speaker });
+				subtitle.SetText("Let me guess... someone stole your sweetroll.");
+				subtitle.SetVoice("Data\\Sound\\Voice\\Skyrim.esm\\MaleGuard\\line.fuz");
+			}
+		}
+
+		Pipeline     pipeline;
+		CountingSink sink;
+		for (auto _ : a_state) {
+			for (auto record : records) {
+				pipeline.Push(record);
+			}
+			pipeline.Drain(sink);
+		}
+
+		if (pipeline.TakeDropped() != 0) {
+			a_state.SkipWithError("the queue overflowed, lower the crowd size");
+		}
+		a_state.counters["saved"] = benchmark::Counter(static_cast<double>(sink.lines), benchmark::Counter::kAvgIterations);
+		a_state.SetItemsProcessed(static_cast<std::int64_t>(a_state.iterations() * records.size()));
+	}
+}
+
+BENCHMARK(BM_RemoveDuplicateTopics)->RangeMultiplier(4)->Range(16, 4096);
+BENCHMARK(BM_RemoveDuplicateTopicsAnyOf)->RangeMultiplier(4)->Range(16, 4096);
+BENCHMARK(BM_CrowdedCity)->RangeMultiplier(2)->Range(16, 128);  // the queue holds 256 records a frame
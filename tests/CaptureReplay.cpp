@@ -0,0 +1,450 @@
+#include "AllocationCounter.h"
+#include "CaptureSession.h"
+#include "GlobalHistory.h"
+#include "HistoryStubs.h"
+#include "NPCNameProvider.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+// replays a recorded (or synthetic) play session through the capture pipeline into the plugin's global history and a
+// stand-in for local history, and reports capture latency, memory growth and the save/load times of the history files
+//
+//   capture_replay <DialogueHistory_Capture.bin>
+//   capture_replay --synthetic [conversations]
+
+namespace
+{
+	using namespace Capture;
+
+	constexpr std::uint32_t playerID = 0x14;
+
+	std::string_view GetSpeakerName(std::uint32_t a_speaker)
+	{
+		return a_speaker == playerID ? "Prisoner"sv : Stubs::speakers[a_speaker % Stubs::speakers.size()];
+	}
+
+	std::string_view GetLocationName(std::uint32_t a_speaker)
+	{
+		return Stubs::locations[a_speaker % Stubs::locations.size()];
+	}
+
+	// stands in for TESTopicInfo::GetDialogueData
+	std::string_view GetTopicLine(std::uint32_t a_topicInfo)
+	{
+		static constexpr std::array lines{
+			"Let me guess... someone stole your sweetroll."sv,
+			"I used to be an adventurer like you, then I took an arrow in the knee."sv,
+			"Disrespect the law, and you disrespect me."sv,
+			"No lollygaggin'."sv,
+			"Watch the skies, traveler."sv
+		};
+		return lines[a_topicInfo % lines.size()];
+	}
+
+	struct Stats
+	{
+		void Add(double a_ms)
+		{
+			count++;
+			total += a_ms;
+			max = std::max(max, a_ms);
+		}
+
+		// members
+		std::size_t count{ 0 };
+		double      total{ 0.0 };
+		double      max{ 0.0 };
+	};
+
+	// the speakers and their locations as forms, so InitHistory resolves them after a load
+	class World
+	{
+	public:
+		static constexpr std::uint32_t firstSpeaker{ 0x100 };
+		static constexpr std::uint32_t lastSpeaker{ 0x1FF };
+		static constexpr std::uint32_t locationBase{ 0x0B0000 };
+
+		World()
+		{
+			for (auto speaker = firstSpeaker; speaker <= lastSpeaker; speaker++) {
+				actors.emplace_back(speaker, std::string(GetSpeakerName(speaker)));
+			}
+			for (std::uint32_t i = 0; i < Stubs::locations.size(); i++) {
+				locations.emplace_back(locationBase + i, std::string(Stubs::locations[i]));
+			}
+		}
+
+		static RE::FormID GetLocation(std::uint32_t a_speaker)
+		{
+			return locationBase + static_cast<RE::FormID>(a_speaker % Stubs::locations.size());
+		}
+
+	private:
+		// members
+		std::deque<RE::Actor>       actors;  // forms register their address, a deque never moves them
+		std::deque<RE::BGSLocation> locations;
+	};
+
+	// LocalHistory (the open dialogue) as a stand-in, GlobalHistory's dialogue and conversation histories and their
+	// files as the plugin has them
+	class StandInHost : public Session::IHost
+	{
+	public:
+		explicit StandInHost(std::string a_save) :
+			save(std::move(a_save))
+		{}
+
+		~StandInHost() override
+		{
+			dialogueHistory.DeleteSavedFile(save);
+			conversationHistory.DeleteSavedFile(save);
+		}
+
+		// LocalHistory::AddDialogue
+		void AddPlayerLine(std::string_view a_text) override
+		{
+			AddLine(playerID, a_text, {});
+		}
+
+		void AddSpeakerLine(std::uint32_t a_speaker, std::string_view a_text, std::string_view a_voice) override
+		{
+			AddLine(a_speaker, a_text, a_voice);
+		}
+
+		// GlobalHistory::Manager::AddConversations, minus the distance checks
+		void AddConversations(std::span<const TopicEnd> a_topics) override
+		{
+			for (const auto& topic : a_topics) {
+				if (topic.speaker == 0 || topic.speaker == playerID || (menuOpen && topic.speaker == currentSpeaker)) {
+					continue;
+				}
+
+				Monologue monologue;
+				monologue.timeStamp = TimeStampKey::Generate(topic.time);
+				monologue.id.SetNumericID(topic.speaker);
+				monologue.loc.SetNumericID(World::GetLocation(topic.speaker));
+				monologue.speakerName = GetSpeakerName(topic.speaker);
+				monologue.locName = GetLocationName(topic.speaker);
+				monologue.line.line = GetTopicLine(topic.topicInfo);
+				monologue.line.voice = "Sound\\Voice\\Skyrim.esm\\MaleGuard\\DialogueGe_" + std::to_string(topic.topicInfo) + "_1.fuz";
+				monologue.topic.SetNumericID(topic.topicInfo);
+				monologue.dialogueType = 1;
+
+				conversationHistory.SaveHistory(topic.time, monologue);
+			}
+		}
+
+		// LocalHistory::Manager::SetDialogueMenuOpen, then GlobalHistory::Manager::SaveDialogueHistory
+		void SetDialogueMenuOpen(bool a_opened) override
+		{
+			menuOpen = a_opened;
+			if (a_opened) {
+				current = {};
+				current.timeStamp = TimeStampKey::Generate(gameTime);
+				current.playerName = GetSpeakerName(playerID);
+				currentTime = gameTime;
+				currentSpeaker = 0;
+			} else if (!current.dialogue.empty()) {
+				dialogueHistory.SaveHistory(currentTime, current, false);
+				current = {};
+			}
+		}
+
+		// GlobalHistory::Manager::SaveFiles
+		void SaveFiles() override
+		{
+			dialogueHistory.SaveHistoryToFile(save);
+			conversationHistory.SaveHistoryToFile(save);
+		}
+
+		// GlobalHistory::Manager::LoadFiles, then the InitHistory calls that finish the load
+		void LoadFiles() override
+		{
+			Clear();
+			NPCNameProvider::GetSingleton()->ClearCache();
+
+			if (dialogueHistory.LoadHistoryFromFile(save)) {
+				dialogueHistory.InitHistory();
+			}
+			if (conversationHistory.LoadHistoryFromFile(save)) {
+				conversationHistory.InitHistory();
+			}
+		}
+
+		void Clear() override
+		{
+			dialogueHistory.Clear();
+			dialogueHistory.history.clear();
+			conversationHistory.Clear();
+			conversationHistory.history.monologues.clear();
+			current = {};
+			currentSpeaker = 0;
+			menuOpen = false;
+		}
+
+		std::size_t GetFileSize()
+		{
+			std::size_t size = 0;
+			for (const auto& path : { dialogueHistory.GetFile(save), conversationHistory.GetFile(save) }) {
+				std::error_code ec;
+				if (const auto fileSize = path ? std::filesystem::file_size(*path, ec) : 0; !ec) {
+					size += static_cast<std::size_t>(fileSize);
+				}
+			}
+			return size;
+		}
+
+		// members
+		std::tm                            gameTime{};  // stands in for the calendar, set from the records
+		GlobalHistory::DialogueHistory     dialogueHistory{};
+		GlobalHistory::ConversationHistory conversationHistory{};
+
+	private:
+		// duplicate opening lines are dropped, lines from anyone but the first speaker are ignored
+		void AddLine(std::uint32_t a_speaker, std::string_view a_text, std::string_view a_voice)
+		{
+			if (a_speaker != playerID) {
+				if (currentSpeaker == 0) {
+					currentSpeaker = a_speaker;
+					current.id.SetNumericID(a_speaker);
+					current.loc.SetNumericID(World::GetLocation(a_speaker));
+					current.speakerName = GetSpeakerName(a_speaker);
+					current.locName = GetLocationName(a_speaker);
+				}
+				if (currentSpeaker != a_speaker) {
+					return;
+				}
+			}
+
+			auto& line = current.dialogue.emplace_back();
+			line.line = a_text;
+			line.voice = a_voice;
+			line.name = GetSpeakerName(a_speaker);
+			line.isPlayer = a_speaker == playerID;
+
+			if (auto& dialogue = current.dialogue; dialogue.size() == 2 && dialogue[0].line == dialogue[1].line && dialogue[0].voice == dialogue[1].voice) {
+				dialogue.erase(dialogue.begin());
+			}
+		}
+
+		// members
+		std::string   save;
+		bool          menuOpen{ false };
+		std::uint32_t currentSpeaker{ 0 };
+		std::tm       currentTime{};
+		Dialogue      current{};
+	};
+
+	// a_conversations dialogue menus with ambient lines between them, a save every 25 and a load halfway
+	void WriteSyntheticSession(const std::filesystem::path& a_path, std::size_t a_conversations, std::uint32_t a_seed = 1)
+	{
+		std::mt19937                                 rng(a_seed);
+		std::uniform_int_distribution<std::uint32_t> speaker(0x100, 0x1FF);
+		std::uniform_int_distribution<std::uint32_t> topicInfo(0x10000, 0x1FFFF);
+		std::uniform_int_distribution<int>           exchanges(1, 6);
+		std::uniform_int_distribution<int>           ambient(0, 3);
+
+		std::ofstream stream(a_path, std::ios::binary | std::ios::trunc);
+		Session::WriteHeader(stream);
+
+		std::uint64_t time = 0;
+		std::tm       gameTime{};
+		gameTime.tm_year = 201;
+		gameTime.tm_mon = 7;
+		gameTime.tm_mday = 17;
+		gameTime.tm_hour = 8;
+
+		const auto write = [&](Session::EVENT a_type, std::uint32_t a_value = 0) {
+			time += 16667;  // a frame
+			Session::WriteEvent(stream, { .type = a_type, .time = time, .value = a_value });
+		};
+		const auto writeRecord = [&](TYPE a_type, std::uint32_t a_speaker, std::uint32_t a_topicInfo, std::string_view a_text) {
+			Session::Event event{ .type = Session::EVENT::kRecord, .time = time += 500 };
+			event.record = { .type = a_type, .speaker = a_speaker, .topicInfo = a_topicInfo, .time = gameTime };
+			event.record.SetText(a_text);
+			if (a_type == TYPE::kSpeakerLine) {
+				event.record.SetVoice("Data\\Sound\\Voice\\Skyrim.esm\\FemaleEvenToned\\DialogueGe_" + std::to_string(a_topicInfo) + "_1.fuz");
+			}
+			Session::WriteEvent(stream, event);
+		};
+
+		for (std::size_t i = 0; i < a_conversations; i++) {
+			gameTime.tm_min += 7;
+			if (gameTime.tm_min >= 60) {
+				gameTime.tm_min -= 60;
+				if (++gameTime.tm_hour == 24) {
+					gameTime.tm_hour = 0;
+					gameTime.tm_mday = gameTime.tm_mday % 30 + 1;
+				}
+			}
+
+			const auto npc = speaker(rng);
+
+			write(Session::EVENT::kDialogueMenu, 1);
+			writeRecord(TYPE::kSpeakerLine, npc, topicInfo(rng), "What do you need?");
+			write(Session::EVENT::kDrain);
+			for (int j = exchanges(rng); j > 0; j--) {
+				writeRecord(TYPE::kPlayerLine, 0, 0, "What can you tell me about Whiterun?");
+				write(Session::EVENT::kDrain);
+
+				const auto info = topicInfo(rng);
+				writeRecord(TYPE::kSpeakerLine, npc, info, GetTopicLine(info));
+				writeRecord(TYPE::kTopicEnd, npc, info, {});
+				write(Session::EVENT::kDrain);
+			}
+			write(Session::EVENT::kDialogueMenu, 0);
+
+			for (int j = ambient(rng); j > 0; j--) {
+				const auto info = topicInfo(rng);
+				const auto other = speaker(rng);
+				writeRecord(TYPE::kTopicEnd, other, info, {});
+				writeRecord(TYPE::kTopicEnd, other, info, {});  // reported twice in a frame
+			}
+			write(Session::EVENT::kDrain);
+
+			if (i % 25 == 24) {
+				write(Session::EVENT::kSave);
+			}
+			if (i == a_conversations / 2) {
+				write(Session::EVENT::kLoad);
+			}
+		}
+
+		write(Session::EVENT::kSave);
+	}
+
+	double ToMs(clock::duration a_duration)
+	{
+		return std::chrono::duration<double, std::milli>(a_duration).count();
+	}
+
+	double ToKB(std::size_t a_bytes)
+	{
+		return static_cast<double>(a_bytes) / 1024.0;
+	}
+
+	void PrintLatency(const char* a_label, const Latency& a_latency)
+	{
+		if (a_latency.count == 0) {
+			std::printf("%-26s: none\n", a_label);
+			return;
+		}
+		std::printf("%-26s: %zu records, avg %.3f ms, max %.3f ms\n", a_label, a_latency.count, a_latency.total / 1000.0 / static_cast<double>(a_latency.count), a_latency.max / 1000.0);
+	}
+
+	void PrintStats(const char* a_label, const Stats& a_stats)
+	{
+		if (a_stats.count == 0) {
+			std::printf("%-26s: none\n", a_label);
+			return;
+		}
+		std::printf("%-26s: %zu, avg %.3f ms, max %.3f ms\n", a_label, a_stats.count, a_stats.total / static_cast<double>(a_stats.count), a_stats.max);
+	}
+
+	void AddLatency(Latency& a_total, const Latency& a_latency)
+	{
+		a_total.count += a_latency.count;
+		a_total.total += a_latency.total;
+		a_total.max = std::max(a_total.max, a_latency.max);
+	}
+}
+
+int main(int a_argc, char* a_argv[])
+{
+	const auto tempDir = std::filesystem::temp_directory_path();
+
+	std::filesystem::path sessionPath;
+	const bool            synthetic = a_argc < 2 || std::string_view(a_argv[1]) == "--synthetic";
+	if (synthetic) {
+		const auto conversations = a_argc > 2 ? std::strtoul(a_argv[2], nullptr, 10) : 500;
+		sessionPath = tempDir / "capture_replay_session.bin";
+		WriteSyntheticSession(sessionPath, conversations);
+	} else {
+		sessionPath = a_argv[1];
+	}
+
+	auto events = Session::Load(sessionPath);
+	if (synthetic) {
+		std::error_code ec;
+		std::filesystem::remove(sessionPath, ec);
+	}
+	if (!events || events->empty()) {
+		std::fprintf(stderr, "%s is not a capture session\n", sessionPath.string().c_str());
+		return EXIT_FAILURE;
+	}
+
+	// hook to drain as it happened in game, each record against the drain after it
+	Latency                    recorded{};
+	std::vector<std::uint64_t> pending;
+	for (const auto& event : *events) {
+		if (event.type == Session::EVENT::kRecord) {
+			pending.push_back(event.time);
+		} else if (event.type == Session::EVENT::kLoad || event.type == Session::EVENT::kNewGame) {
+			pending.clear();
+		} else {
+			for (const auto time : pending) {
+				const auto us = static_cast<std::int64_t>(event.time) - static_cast<std::int64_t>(time);
+				AddLatency(recorded, { 1, std::max<std::int64_t>(us, 0), std::max<std::int64_t>(us, 0) });
+			}
+			pending.clear();
+		}
+	}
+
+	const auto records = std::ranges::count(*events, Session::EVENT::kRecord, &Session::Event::type);
+
+	World world;
+
+	auto host = std::make_unique<StandInHost>("capture_replay");
+	auto pipeline = std::make_unique<Pipeline>();
+
+	Stats   saves;
+	Stats   loads;
+	Latency replayed{};
+
+	const auto startBytes = AllocationCounter::GetLiveBytes();
+	AllocationCounter::ResetPeakBytes();
+
+	const auto start = clock::now();
+	for (const auto& event : *events) {
+		if (event.type == Session::EVENT::kRecord && event.record.time.tm_year != 0) {
+			host->gameTime = event.record.time;
+		}
+
+		// Clear resets the latency
+		if (event.type == Session::EVENT::kLoad || event.type == Session::EVENT::kNewGame) {
+			AddLatency(replayed, pipeline->GetLatency());
+		}
+
+		const auto eventStart = clock::now();
+		Session::Replay(event, *pipeline, *host);
+		const auto eventTime = ToMs(clock::now() - eventStart);
+
+		if (event.type == Session::EVENT::kSave) {
+			saves.Add(eventTime);
+		} else if (event.type == Session::EVENT::kLoad) {
+			loads.Add(eventTime);
+		}
+	}
+	const auto replayTime = ToMs(clock::now() - start);
+	AddLatency(replayed, pipeline->GetLatency());
+
+	const auto endBytes = AllocationCounter::GetLiveBytes();
+	const auto growth = endBytes > startBytes ? endBytes - startBytes : 0;
+
+	std::printf("%-26s: %s, %zu events, %td records\n", "Session", synthetic ? "synthetic" : sessionPath.string().c_str(), events->size(), records);
+	std::printf("%-26s: %.3f ms\n", "Replay", replayTime);
+	PrintLatency("Capture latency (recorded)", recorded);
+	PrintLatency("Capture latency (replay)", replayed);
+	if (const auto dropped = pipeline->TakeDropped(); dropped > 0) {
+		std::printf("%-26s: %zu records\n", "Dropped", dropped);
+	}
+	PrintStats("Saves (JSON)", saves);
+	PrintStats("Loads (JSON, InitHistory)", loads);
+	std::printf("%-26s: %.1f KB\n", "Save files", ToKB(host->GetFileSize()));
+	std::printf("%-26s: %.1f KB, peak %.1f KB, %.2f KB per 1000 records\n", "Memory growth", ToKB(growth), ToKB(AllocationCounter::GetPeakBytes() - startBytes),
+		records > 0 ? ToKB(growth) * 1000.0 / static_cast<double>(records) : 0.0);
+	std::printf("%-26s: %zu dialogues, %zu conversation lines\n", "History", host->dialogueHistory.history.size(), host->conversationHistory.history.monologues.size());
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,302 @@
+#include "CaptureSession.h"
+#include "TimeStampKey.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace
+{
+	using namespace Capture;
+
+	// records what reached history
+	class StubSink : public ISink
+	{
+	public:
+		void AddPlayerLine(std::string_view a_text) override
+		{
+			lines.push_back("player: " + std::string(a_text));
+		}
+
+		void AddSpeakerLine(std::uint32_t a_speaker, std::string_view a_text, std::string_view a_voice) override
+		{
+			lines.push_back(std::to_string(a_speaker) + ": " + std::string(a_text) + " [" + std::string(a_voice) + "]");
+		}
+
+		void AddConversations(std::span<const TopicEnd> a_topics) override
+		{
+			batches.emplace_back(a_topics.begin(), a_topics.end());
+		}
+
+		// members
+		std::vector<std::string>           lines;
+		std::vector<std::vector<TopicEnd>> batches;
+	};
+
+	class StubHost : public Session::IHost
+	{
+	public:
+		void AddPlayerLine(std::string_view a_text) override { calls.push_back("player " + std::string(a_text)); }
+		void AddSpeakerLine(std::uint32_t, std::string_view a_text, std::string_view) override { calls.push_back("speaker " + std::string(a_text)); }
+		void AddConversations(std::span<const TopicEnd> a_topics) override { calls.push_back("conversations " + std::to_string(a_topics.size())); }
+
+		void SetDialogueMenuOpen(bool a_opened) override { calls.push_back(a_opened ? "open" : "close"); }
+		void SaveFiles() override { calls.push_back("save"); }
+		void LoadFiles() override { calls.push_back("load"); }
+		void Clear() override { calls.push_back("clear"); }
+
+		// members
+		std::vector<std::string> calls;
+	};
+
+	Record MakeRecord(TYPE a_type, std::uint32_t a_speaker, std::string_view a_text, std::string_view a_voice = {})
+	{
+		Record record{ .type = a_type, .speaker = a_speaker };
+		record.SetText(a_text);
+		record.SetVoice(a_voice);
+		return record;
+	}
+}
+
+TEST(CapturePipeline, DrainsInPushOrder)
+{
+	Pipeline pipeline;
+	StubSink sink;
+
+	auto player = MakeRecord(TYPE::kPlayerLine, 0x14, "What do you have for sale?");
+	auto speaker = MakeRecord(TYPE::kSpeakerLine, 0x1A, "Take a look.", "Data\\Sound\\Voice\\Skyrim.esm\\MaleNord\\line.fuz");
+	pipeline.Push(player);
+	pipeline.Push(speaker);
+
+	EXPECT_EQ(pipeline.Drain(sink), 2);
+	EXPECT_EQ(sink.lines, (std::vector<std::string>{ "player: What do you have for sale?", "26: Take a look. [Sound\\Voice\\Skyrim.esm\\MaleNord\\line.fuz]" }));
+	EXPECT_EQ(pipeline.Drain(sink), 0);
+}
+
+TEST(CapturePipeline, BlankSubtitlesBecomeEllipsis)
+{
+	Pipeline pipeline;
+	StubSink sink;
+
+	for (const auto text : { ""sv, " "sv }) {
+		auto record = MakeRecord(TYPE::kSpeakerLine, 1, text);
+		pipeline.Push(record);
+	}
+	pipeline.Drain(sink);
+
+	EXPECT_EQ(sink.lines, (std::vector<std::string>{ "1: ... []", "1: ... []" }));
+}
+
+TEST(CapturePipeline, TopicEndsBatchPerDrain)
+{
+	Pipeline pipeline;
+	StubSink sink;
+
+	for (std::uint32_t i = 0; i < 3; i++) {
+		Record record{ .type = TYPE::kTopicEnd, .speaker = i, .topicInfo = 100 + i };
+		pipeline.Push(record);
+	}
+	pipeline.Drain(sink);
+	pipeline.Drain(sink);
+
+	ASSERT_EQ(sink.batches.size(), 1);
+	ASSERT_EQ(sink.batches[0].size(), 3);
+	EXPECT_EQ(sink.batches[0][2].topicInfo, 102);
+}
+
+TEST(CapturePipeline, TopicEndsKeepFirstOfEachLine)
+{
+	Pipeline pipeline;
+	StubSink sink;
+
+	// the same speaker and topic info twice, the same topic info from another speaker
+	constexpr std::array<std::pair<std::uint32_t, std::uint32_t>, 6> topics{ { { 1, 100 }, { 2, 100 }, { 1, 100 }, { 3, 101 }, { 2, 100 }, { 1, 102 } } };
+	for (std::uint32_t i = 0; i < topics.size(); i++) {
+		Record record{ .type = TYPE::kTopicEnd, .speaker = topics[i].first, .topicInfo = topics[i].second };
+		record.time.tm_min = static_cast<int>(i);
+		pipeline.Push(record);
+	}
+	pipeline.Drain(sink);
+
+	ASSERT_EQ(sink.batches.size(), 1);
+	std::vector<int> order;  // push order, kept
+	for (const auto& topic : sink.batches[0]) {
+		order.push_back(topic.time.tm_min);
+	}
+	EXPECT_EQ(order, (std::vector{ 0, 1, 3, 5 }));
+}
+
+TEST(CapturePipeline, CountsDroppedRecords)
+{
+	Pipeline pipeline;
+	StubSink sink;
+
+	for (int i = 0; i < 300; i++) {
+		auto record = MakeRecord(TYPE::kPlayerLine, 0, "line");
+		pipeline.Push(record);
+	}
+
+	EXPECT_EQ(pipeline.TakeDropped(), 44);
+	EXPECT_EQ(pipeline.TakeDropped(), 0);
+	EXPECT_EQ(pipeline.Drain(sink), 256);
+}
+
+TEST(CapturePipeline, LatencyIsTakenPerRecord)
+{
+	Pipeline pipeline;
+	StubSink sink;
+
+	auto record = MakeRecord(TYPE::kPlayerLine, 0, "line");
+	pipeline.Push(record);
+	std::this_thread::sleep_for(2ms);
+	pipeline.Drain(sink);
+
+	const auto& latency = pipeline.GetLatency();
+	EXPECT_EQ(latency.count, 1);
+	EXPECT_GE(latency.max, 2000);
+	EXPECT_EQ(latency.total, latency.max);
+
+	pipeline.ResetLatency();
+	EXPECT_EQ(pipeline.GetLatency().count, 0);
+}
+
+// a line pushed while the drain runs is popped by the same drain, it used to be timed against the earlier now
+TEST(CapturePipeline, LatencyIsNeverNegative)
+{
+	Pipeline pipeline;
+	StubSink sink;
+
+	auto record = MakeRecord(TYPE::kPlayerLine, 0, "first");
+	pipeline.Push(record);
+	std::this_thread::sleep_for(1ms);
+
+	bool pushed = false;
+	pipeline.Drain(sink, [&](const Record&) {
+		if (!std::exchange(pushed, true)) {
+			std::this_thread::sleep_for(1ms);
+			auto late = MakeRecord(TYPE::kPlayerLine, 0, "late");
+			pipeline.Push(late);
+		}
+	});
+
+	const auto& latency = pipeline.GetLatency();
+	EXPECT_EQ(latency.count, 2);
+	EXPECT_GE(latency.total, latency.max);
+	EXPECT_EQ(sink.lines.size(), 2);
+}
+
+TEST(CapturePipeline, ClearDropsQueuedRecords)
+{
+	Pipeline pipeline;
+	StubSink sink;
+
+	auto record = MakeRecord(TYPE::kPlayerLine, 0, "stale");
+	pipeline.Push(record);
+	pipeline.Clear();
+
+	EXPECT_EQ(pipeline.Drain(sink), 0);
+	EXPECT_TRUE(sink.lines.empty());
+}
+
+TEST(CaptureRecord, TruncatesOnCharacterBoundary)
+{
+	Record record;
+
+	// 511 bytes fit, the second character doesn't
+	std::string text(513, 'a');
+	text.replace(509, 4, "\xC3\xA9\xC3\xA9");
+	record.SetText(text);
+	EXPECT_EQ(record.GetText().size(), 511);
+	EXPECT_EQ(record.GetText().substr(509), "\xC3\xA9");
+
+	// the first character would be split
+	text.insert(text.begin(), 'a');
+	record.SetText(text);
+	EXPECT_EQ(record.GetText(), std::string(510, 'a'));
+}
+
+TEST(CaptureSession, EventsRoundTrip)
+{
+	Session::Event record{ .type = Session::EVENT::kRecord, .time = 1234567 };
+	record.record = MakeRecord(TYPE::kSpeakerLine, 0xFF000D62, "Hail, Dragonborn.", "Data\\Sound\\Voice\\line.fuz");
+	record.record.topicInfo = 0x0001A2B3;
+	record.record.time.tm_year = 201;
+	record.record.time.tm_mon = 7;
+	record.record.time.tm_mday = 17;
+	record.record.time.tm_hour = 13;
+	record.record.time.tm_min = 5;
+
+	const Session::Event menu{ .type = Session::EVENT::kDialogueMenu, .time = 1300000, .value = 1 };
+
+	std::stringstream stream;
+	Session::WriteHeader(stream);
+	Session::WriteEvent(stream, record);
+	Session::WriteEvent(stream, menu);
+
+	ASSERT_TRUE(Session::ReadHeader(stream));
+
+	Session::Event event;
+	ASSERT_TRUE(Session::ReadEvent(stream, event));
+	EXPECT_EQ(event.type, Session::EVENT::kRecord);
+	EXPECT_EQ(event.time, 1234567);
+	EXPECT_EQ(event.record.type, TYPE::kSpeakerLine);
+	EXPECT_EQ(event.record.speaker, 0xFF000D62);
+	EXPECT_EQ(event.record.topicInfo, 0x0001A2B3);
+	EXPECT_EQ(event.record.GetText(), "Hail, Dragonborn.");
+	EXPECT_EQ(event.record.GetVoice(), "Data\\Sound\\Voice\\line.fuz");
+	EXPECT_EQ(TimeStampKey::Generate(event.record.time), TimeStampKey::Generate(record.record.time));
+
+	ASSERT_TRUE(Session::ReadEvent(stream, event));
+	EXPECT_EQ(event.type, Session::EVENT::kDialogueMenu);
+	EXPECT_EQ(event.value, 1);
+
+	EXPECT_FALSE(Session::ReadEvent(stream, event));
+}
+
+TEST(CaptureSession, RejectsOtherFiles)
+{
+	std::stringstream stream("DHIR\x02\0\0\0"s);
+	EXPECT_FALSE(Session::ReadHeader(stream));
+}
+
+TEST(CaptureSession, TruncatedEventFails)
+{
+	std::stringstream stream;
+	Session::WriteEvent(stream, { .type = Session::EVENT::kRecord, .record = MakeRecord(TYPE::kPlayerLine, 0, "cut short") });
+
+	auto data = stream.str();
+	data.resize(data.size() - 3);
+
+	std::stringstream truncated(data);
+	Session::Event    event;
+	EXPECT_FALSE(Session::ReadEvent(truncated, event));
+}
+
+TEST(CaptureSession, ReplayFollowsPluginOrder)
+{
+	Pipeline pipeline;
+	StubHost host;
+
+	const auto line = [](TYPE a_type, std::string_view a_text) {
+		return Session::Event{ .type = Session::EVENT::kRecord, .record = MakeRecord(a_type, 7, a_text) };
+	};
+
+	const std::vector<Session::Event> events{
+		{ .type = Session::EVENT::kDialogueMenu, .value = 1 },
+		line(TYPE::kSpeakerLine, "Greetings."),
+		line(TYPE::kPlayerLine, "Goodbye."),
+		{ .type = Session::EVENT::kDialogueMenu, .value = 0 },
+		{ .type = Session::EVENT::kRecord, .record = { .type = TYPE::kTopicEnd, .speaker = 7, .topicInfo = 1 } },
+		{ .type = Session::EVENT::kSave },
+		line(TYPE::kPlayerLine, "dropped by the load"),
+		{ .type = Session::EVENT::kLoad },
+		{ .type = Session::EVENT::kDrain },
+		{ .type = Session::EVENT::kNewGame },
+	};
+
+	for (const auto& event : events) {
+		Session::Replay(event, pipeline, host);
+	}
+
+	EXPECT_EQ(host.calls, (std::vector<std::string>{ "open", "speaker Greetings.", "player Goodbye.", "close", "conversations 1", "save", "load", "clear" }));
+}
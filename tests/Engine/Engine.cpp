@@ -0,0 +1,199 @@
+#include "Engine.h"
+
+namespace RE
+{
+	namespace
+	{
+		std::unordered_map<FormID, TESForm*>& GetForms()
+		{
+			static std::unordered_map<FormID, TESForm*> forms;
+			return forms;
+		}
+	}
+
+	TESForm::TESForm(FormID a_formID, std::string a_name) :
+		formID(a_formID),
+		name(std::move(a_name))
+	{
+		GetForms().insert_or_assign(formID, this);
+	}
+
+	TESForm::~TESForm()
+	{
+		if (const auto it = GetForms().find(formID); it != GetForms().end() && it->second == this) {
+			GetForms().erase(it);
+		}
+	}
+
+	TESForm* TESForm::LookupForm(FormID a_formID)
+	{
+		const auto it = GetForms().find(a_formID);
+		return it != GetForms().end() ? it->second : nullptr;
+	}
+
+	bool TESObjectREFR::IsPlayerRef() const
+	{
+		return this == PlayerCharacter::GetSingleton();
+	}
+
+	PlayerCharacter::PlayerCharacter() :
+		Actor(0x14, "Prisoner")
+	{}
+
+	PlayerCharacter* PlayerCharacter::GetSingleton()
+	{
+		static PlayerCharacter player;
+		return std::addressof(player);
+	}
+
+	GameSettingCollection* GameSettingCollection::GetSingleton()
+	{
+		static GameSettingCollection collection;
+		return std::addressof(collection);
+	}
+
+	Setting* GameSettingCollection::GetSetting(const char* a_name)
+	{
+		static std::unordered_map<std::string_view, Setting> settings{
+			{ "sMonthJanuary", { "Morning Star" } },
+			{ "sMonthFebruary", { "Sun's Dawn" } },
+			{ "sMonthMarch", { "First Seed" } },
+			{ "sMonthApril", { "Rain's Hand" } },
+			{ "sMonthMay", { "Second Seed" } },
+			{ "sMonthJune", { "Midyear" } },
+			{ "sMonthJuly", { "Sun's Height" } },
+			{ "sMonthAugust", { "Last Seed" } },
+			{ "sMonthSeptember", { "Hearthfire" } },
+			{ "sMonthOctober", { "Frostfall" } },
+			{ "sMonthNovember", { "Sun's Dusk" } },
+			{ "sMonthDecember", { "Evening Star" } },
+			{ "sFirstOrdSuffix", { "st" } },
+			{ "sSecondOrdSuffix", { "nd" } },
+			{ "sThirdOrdSuffix", { "rd" } },
+			{ "sDefaultOrdSuffix", { "th" } },
+			{ "sOf", { " of " } },
+			{ "sTimeAM", { "AM" } },
+			{ "sTimePM", { "PM" } }
+		};
+
+		const auto it = settings.find(a_name);
+		return it != settings.end() ? std::addressof(it->second) : nullptr;
+	}
+
+	Setting* GetINISetting(const char*)
+	{
+		return nullptr;
+	}
+
+	TESDataHandler* TESDataHandler::GetSingleton()
+	{
+		static TESFile files[]{
+			{ "Skyrim.esm", 0x00, 0 },
+			{ "Update.esm", 0x01, 0 },
+			{ "Dawnguard.esm", 0x02, 0 },
+			{ "HearthFires.esm", 0x03, 0 },
+			{ "Dragonborn.esm", 0x04, 0 }
+		};
+		static TESDataHandler dataHandler{ { &files[0], &files[1], &files[2], &files[3], &files[4] } };
+		return std::addressof(dataHandler);
+	}
+
+	void PlaySound(const char*)
+	{}
+
+	ControlMap* ControlMap::GetSingleton()
+	{
+		static ControlMap controlMap;
+		return std::addressof(controlMap);
+	}
+}
+
+namespace SKSE::InputMap
+{
+	std::uint32_t GamepadMaskToKeycode(std::uint32_t a_keyMask)
+	{
+		// the triggers are 9 and 10, the buttons below A are bits 0-9, A to Y are bits 12-15
+		if (a_keyMask == 0x0009 || a_keyMask == 0x000A) {
+			return kMacro_GamepadOffset + 14 + (a_keyMask - 0x0009);
+		}
+		if (!std::has_single_bit(a_keyMask) || a_keyMask > 0x8000 || (a_keyMask > 0x0200 && a_keyMask < 0x1000)) {
+			return kMaxMacros;
+		}
+		const auto bit = static_cast<std::uint32_t>(std::countr_zero(a_keyMask));
+		return kMacro_GamepadOffset + (bit < 12 ? bit : bit - 2);
+	}
+}
+
+namespace SKSE::log
+{
+	std::optional<std::filesystem::path> log_directory()
+	{
+		static const auto directory = []() -> std::optional<std::filesystem::path> {
+			const auto root = std::filesystem::temp_directory_path() / "DialogueHistory";
+
+			std::error_code ec;
+			std::filesystem::create_directories(root / "SKSE", ec);
+			std::filesystem::create_directories(root / "Saves", ec);
+			if (ec) {
+				return std::nullopt;
+			}
+			return root / "SKSE";
+		}();
+
+		return directory;
+	}
+
+	void write(std::string_view a_message)
+	{
+		std::fprintf(stderr, "%.*s\n", static_cast<int>(a_message.size()), a_message.data());
+	}
+}
+
+const char* CSimpleIniA::GetValue(const char* a_section, const char* a_key, const char* a_default) const
+{
+	const auto it = values.find({ a_section, a_key });
+	return it != values.end() ? it->second.c_str() : a_default;
+}
+
+long CSimpleIniA::GetLongValue(const char* a_section, const char* a_key, long a_default) const
+{
+	const auto value = GetValue(a_section, a_key);
+	return value ? std::strtol(value, nullptr, 0) : a_default;
+}
+
+double CSimpleIniA::GetDoubleValue(const char* a_section, const char* a_key, double a_default) const
+{
+	const auto value = GetValue(a_section, a_key);
+	return value ? std::strtod(value, nullptr) : a_default;
+}
+
+bool CSimpleIniA::GetBoolValue(const char* a_section, const char* a_key, bool a_default) const
+{
+	const auto value = GetValue(a_section, a_key);
+	if (!value) {
+		return a_default;
+	}
+	const auto str = string::toupper(value);
+	if (str == "TRUE" || str == "YES" || str == "ON" || str == "1") {
+		return true;
+	}
+	if (str == "FALSE" || str == "NO" || str == "OFF" || str == "0") {
+		return false;
+	}
+	return a_default;
+}
+
+void CSimpleIniA::SetValue(const char* a_section, const char* a_key, const char* a_value)
+{
+	values.insert_or_assign({ a_section, a_key }, a_value);
+}
+
+void CSimpleIniA::SetLongValue(const char* a_section, const char* a_key, long a_value)
+{
+	SetValue(a_section, a_key, std::to_string(a_value).c_str());
+}
+
+void CSimpleIniA::SetBoolValue(const char* a_section, const char* a_key, bool a_value)
+{
+	SetValue(a_section, a_key, a_value ? "true" : "false");
+}
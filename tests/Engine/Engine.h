@@ -0,0 +1,592 @@
+#pragma once
+
+// the parts of CommonLibSSE, SKSE, ClibUtil and SimpleIni the history code reaches, without the game.
+// Forms register themselves by FormID while alive, so LookupByID finds what a test created
+namespace RE
+{
+	using FormID = std::uint32_t;
+
+	enum class BSEventNotifyControl
+	{
+		kContinue,
+		kStop
+	};
+
+	template <class Event>
+	class BSTEventSource;
+
+	template <class Event>
+	class BSTEventSink
+	{
+	public:
+		virtual ~BSTEventSink() = default;
+
+		virtual BSEventNotifyControl ProcessEvent(const Event* a_event, BSTEventSource<Event>* a_eventSource) = 0;
+	};
+
+	struct TESLoadGameEvent
+	{};
+
+	struct TESTopicInfoEvent
+	{};
+
+	class TESTopicInfo;
+
+	enum DIALOGUE_TYPE : std::uint32_t
+	{
+		kPlayerDialogue,
+		kCommandDialogue,
+		kSceneDialogue,
+		kCombat,
+		kFavors,
+		kDetection,
+		kService,
+		kMiscellaneous
+	};
+
+	struct BGSNumericIDIndex
+	{
+		FormID GetNumericID() const
+		{
+			return static_cast<FormID>(data1) << 16 | static_cast<FormID>(data2) << 8 | data3;
+		}
+
+		void SetNumericID(FormID a_formID)
+		{
+			data1 = static_cast<std::uint8_t>(a_formID >> 16);
+			data2 = static_cast<std::uint8_t>(a_formID >> 8);
+			data3 = static_cast<std::uint8_t>(a_formID);
+		}
+
+		// members
+		std::uint8_t data1{ 0 };
+		std::uint8_t data2{ 0 };
+		std::uint8_t data3{ 0 };
+	};
+
+	class TESForm
+	{
+	public:
+		TESForm(FormID a_formID, std::string a_name);
+		virtual ~TESForm();
+
+		TESForm(const TESForm&) = delete;
+		TESForm& operator=(const TESForm&) = delete;
+
+		FormID      GetFormID() const { return formID; }
+		const char* GetName() const { return name.c_str(); }
+
+		template <class T = TESForm>
+		static T* LookupByID(FormID a_formID)
+		{
+			return dynamic_cast<T*>(LookupForm(a_formID));
+		}
+
+	private:
+		static TESForm* LookupForm(FormID a_formID);
+
+		// members
+		FormID      formID;
+		std::string name;
+	};
+
+	class BGSLocation : public TESForm
+	{
+	public:
+		using TESForm::TESForm;
+	};
+
+	class TESObjectCELL : public TESForm
+	{
+	public:
+		using TESForm::TESForm;
+	};
+
+	class TESTopic : public TESForm
+	{
+	public:
+		TESTopic(FormID a_formID, DIALOGUE_TYPE a_type) :
+			TESForm(a_formID, {}),
+			data{ { static_cast<std::uint8_t>(a_type) } }
+		{}
+
+		struct TOPIC_DATA
+		{
+			struct Type
+			{
+				std::uint8_t underlying() const { return value; }
+
+				// members
+				std::uint8_t value;
+			};
+
+			// members
+			Type type;
+		};
+
+		// members
+		TOPIC_DATA data;
+	};
+
+	class TESObjectREFR : public TESForm
+	{
+	public:
+		TESObjectREFR(FormID a_formID, std::string a_name, BGSLocation* a_location = nullptr, TESObjectCELL* a_cell = nullptr) :
+			TESForm(a_formID, std::move(a_name)),
+			location(a_location),
+			cell(a_cell)
+		{}
+
+		BGSLocation*   GetCurrentLocation() const { return location; }
+		TESObjectCELL* GetParentCell() const { return cell; }
+		const char*    GetDisplayFullName() const { return GetName(); }
+		bool           IsPlayerRef() const;
+
+		// members
+		BGSLocation*   location;
+		TESObjectCELL* cell;
+	};
+
+	class Actor : public TESObjectREFR
+	{
+	public:
+		using TESObjectREFR::TESObjectREFR;
+	};
+
+	class PlayerCharacter : public Actor
+	{
+	public:
+		static PlayerCharacter* GetSingleton();
+
+	private:
+		PlayerCharacter();
+	};
+
+	class Setting
+	{
+	public:
+		enum class Type
+		{
+			kUnknown,
+			kBool,
+			kFloat,
+			kSignedInteger,
+			kColor,
+			kString,
+			kUnsignedInteger
+		};
+
+		Type        GetType() const { return Type::kString; }
+		const char* GetString() const { return value; }
+
+		// members
+		const char* value;
+	};
+
+	// English game settings
+	class GameSettingCollection
+	{
+	public:
+		static GameSettingCollection* GetSingleton();
+
+		Setting* GetSetting(const char* a_name);
+	};
+
+	Setting* GetINISetting(const char* a_name);  // nullptr, the game language is English
+
+	class Calendar
+	{
+	public:
+		struct Months
+		{
+			enum Month : std::uint32_t
+			{
+				kMorningStar,
+				kSunsDawn,
+				kFirstSeed,
+				kRainsHand,
+				kSecondSeed,
+				kMidyear,
+				kSunsHeight,
+				kLastSeed,
+				kHearthfire,
+				kFrostfall,
+				kSunsDusk,
+				kEveningStar
+			};
+		};
+		using Month = Months::Month;
+	};
+
+	struct TESFile
+	{
+		std::string_view GetFilename() const { return fileName; }
+
+		// members
+		std::string_view fileName;
+		std::uint8_t     compileIndex;
+		std::uint16_t    smallFileCompileIndex;
+	};
+
+	class TESDataHandler
+	{
+	public:
+		static TESDataHandler* GetSingleton();
+
+		// members
+		std::vector<TESFile*> files;
+	};
+
+	void PlaySound(const char* a_editorID);
+
+	enum class INPUT_DEVICE : std::uint32_t
+	{
+		kNone = static_cast<std::uint32_t>(-1),
+		kKeyboard = 0,
+		kMouse,
+		kGamepad,
+		kVirtualKeyboard
+	};
+
+	class InputEvent;  // only Input::Manager::ProcessInputEvents, in src/InputQueue.cpp, reads one
+
+	// DirectInput scan codes
+	class BSWin32KeyboardDevice
+	{
+	public:
+		struct Keys
+		{
+			enum Key : std::uint32_t
+			{
+				kEscape = 0x01,
+				kNum1,
+				kNum2,
+				kNum3,
+				kNum4,
+				kNum5,
+				kNum6,
+				kNum7,
+				kNum8,
+				kNum9,
+				kNum0,
+				kMinus,
+				kEquals,
+				kBackspace,
+				kTab,
+				kQ,
+				kW,
+				kE,
+				kR,
+				kT,
+				kY,
+				kU,
+				kI,
+				kO,
+				kP,
+				kBracketLeft,
+				kBracketRight,
+				kEnter,
+				kLeftControl,
+				kA,
+				kS,
+				kD,
+				kF,
+				kG,
+				kH,
+				kJ,
+				kK,
+				kL,
+				kSemicolon,
+				kApostrophe,
+				kTilde,
+				kLeftShift,
+				kBackslash,
+				kZ,
+				kX,
+				kC,
+				kV,
+				kB,
+				kN,
+				kM,
+				kComma,
+				kPeriod,
+				kSlash,
+				kRightShift,
+				kKP_Multiply,
+				kLeftAlt,
+				kSpacebar,
+				kCapsLock,
+				kF1,
+				kF2,
+				kF3,
+				kF4,
+				kF5,
+				kF6,
+				kF7,
+				kF8,
+				kF9,
+				kF10,
+				kNumLock,
+				kScrollLock,
+				kKP_7,
+				kKP_8,
+				kKP_9,
+				kKP_Subtract,
+				kKP_4,
+				kKP_5,
+				kKP_6,
+				kKP_Plus,
+				kKP_1,
+				kKP_2,
+				kKP_3,
+				kKP_0,
+				kKP_Decimal,
+				kF11 = 0x57,
+				kF12,
+				kKP_Enter = 0x9C,
+				kRightControl,
+				kKP_Divide = 0xB5,
+				kPrintScreen = 0xB7,
+				kRightAlt,
+				kPause = 0xC5,
+				kHome = 0xC7,
+				kUp,
+				kPageUp,
+				kLeft = 0xCB,
+				kRight = 0xCD,
+				kEnd = 0xCF,
+				kDown,
+				kPageDown,
+				kInsert,
+				kDelete,
+				kLeftWin = 0xDB,
+				kRightWin,
+				kAPPS
+			};
+		};
+		using Key = Keys::Key;
+	};
+
+	class BSWin32MouseDevice
+	{
+	public:
+		struct Keys
+		{
+			enum Key : std::uint32_t
+			{
+				kLeftButton,
+				kRightButton,
+				kMiddleButton,
+				kButton3,
+				kButton4,
+				kButton5,
+				kButton6,
+				kButton7,
+				kWheelUp,
+				kWheelDown
+			};
+		};
+		using Key = Keys::Key;
+	};
+
+	// XInput button masks
+	class BSWin32GamepadDevice
+	{
+	public:
+		struct Keys
+		{
+			enum Key : std::uint32_t
+			{
+				kUp = 0x0001,
+				kDown = 0x0002,
+				kLeft = 0x0004,
+				kRight = 0x0008,
+				kStart = 0x0010,
+				kBack = 0x0020,
+				kLeftThumb = 0x0040,
+				kRightThumb = 0x0080,
+				kLeftShoulder = 0x0100,
+				kRightShoulder = 0x0200,
+				kA = 0x1000,
+				kB = 0x2000,
+				kX = 0x4000,
+				kY = 0x8000
+			};
+		};
+		using Key = Keys::Key;
+	};
+
+	class BSPCOrbisGamepadDevice
+	{
+	public:
+		struct Keys
+		{
+			enum Key : std::uint32_t
+			{
+				kUp = 0x0001,
+				kDown = 0x0002,
+				kLeft = 0x0004,
+				kRight = 0x0008,
+				kPS3_Start = 0x0010,
+				kPS3_Back = 0x0020,
+				kPS3_L3 = 0x0040,
+				kPS3_R3 = 0x0080,
+				kPS3_LB = 0x0100,
+				kPS3_RB = 0x0200,
+				kPS3_A = 0x1000,
+				kPS3_B = 0x2000,
+				kPS3_X = 0x4000,
+				kPS3_Y = 0x8000
+			};
+		};
+		using Key = Keys::Key;
+	};
+
+	enum class PC_GAMEPAD_TYPE : std::uint32_t
+	{
+		kDirectX,
+		kOrbis
+	};
+
+	class ControlMap
+	{
+	public:
+		static ControlMap* GetSingleton();
+
+		PC_GAMEPAD_TYPE GetGamePadType() const { return gamePadType; }
+
+		// members
+		PC_GAMEPAD_TYPE gamePadType{ PC_GAMEPAD_TYPE::kDirectX };
+	};
+}
+
+namespace REX
+{
+	template <class T>
+	class Singleton
+	{
+	public:
+		static T* GetSingleton()
+		{
+			static T singleton;
+			return std::addressof(singleton);
+		}
+
+	protected:
+		Singleton() = default;
+		~Singleton() = default;
+
+		Singleton(const Singleton&) = delete;
+		Singleton& operator=(const Singleton&) = delete;
+	};
+}
+
+namespace SKSE
+{
+	struct ModCallbackEvent
+	{};
+
+	// keycodes of SKSE's input map, keyboard scan codes first
+	namespace InputMap
+	{
+		enum : std::uint32_t
+		{
+			kMacro_KeyboardOffset = 0,
+			kMacro_MouseButtonOffset = 256,
+			kMacro_GamepadOffset = 266,
+			kGamepadButtonOffset_A = kMacro_GamepadOffset + 10,
+			kGamepadButtonOffset_B,
+			kMaxMacros = kMacro_GamepadOffset + 16
+		};
+
+		std::uint32_t GamepadMaskToKeycode(std::uint32_t a_keyMask);
+	}
+
+	// warnings and errors go to stderr, the rest is dropped
+	namespace log
+	{
+		std::optional<std::filesystem::path> log_directory();  // under the temp directory, next to a Saves folder
+
+		void write(std::string_view a_message);
+
+		template <class... Args>
+		void trace(std::format_string<Args...>, Args&&...)
+		{}
+
+		template <class... Args>
+		void debug(std::format_string<Args...>, Args&&...)
+		{}
+
+		template <class... Args>
+		void info(std::format_string<Args...>, Args&&...)
+		{}
+
+		template <class... Args>
+		void warn(std::format_string<Args...> a_fmt, Args&&... a_args)
+		{
+			write(std::format(a_fmt, std::forward<Args>(a_args)...));
+		}
+
+		template <class... Args>
+		void error(std::format_string<Args...> a_fmt, Args&&... a_args)
+		{
+			write(std::format(a_fmt, std::forward<Args>(a_args)...));
+		}
+
+		template <class... Args>
+		void critical(std::format_string<Args...> a_fmt, Args&&... a_args)
+		{
+			write(std::format(a_fmt, std::forward<Args>(a_args)...));
+		}
+	}
+}
+
+namespace clib_util::string
+{
+	inline bool icontains(std::string_view a_str, std::string_view a_substr)
+	{
+		const auto match = std::ranges::search(a_str, a_substr, [](char a_lhs, char a_rhs) {
+			return std::toupper(static_cast<unsigned char>(a_lhs)) == std::toupper(static_cast<unsigned char>(a_rhs));
+		});
+		return !match.empty() || a_substr.empty();
+	}
+
+	inline std::string toupper(std::string a_str)
+	{
+		std::ranges::transform(a_str, a_str.begin(), [](unsigned char a_char) { return static_cast<char>(std::toupper(a_char)); });
+		return a_str;
+	}
+
+	template <class T>
+	T to_num(const std::string& a_str)
+	{
+		T value{};
+		std::from_chars(a_str.data(), a_str.data() + a_str.size(), value);
+		return value;
+	}
+}
+
+namespace ankerl::unordered_dense
+{
+	template <class T>
+	struct hash : std::hash<T>
+	{};
+}
+
+// settings are at their defaults unless a test sets them
+class CSimpleIniA
+{
+public:
+	const char* GetValue(const char* a_section, const char* a_key, const char* a_default = nullptr) const;
+	long        GetLongValue(const char* a_section, const char* a_key, long a_default = 0) const;
+	double      GetDoubleValue(const char* a_section, const char* a_key, double a_default = 0.0) const;
+	bool        GetBoolValue(const char* a_section, const char* a_key, bool a_default = false) const;
+
+	void SetValue(const char* a_section, const char* a_key, const char* a_value);
+	void SetLongValue(const char* a_section, const char* a_key, long a_value);
+	void SetBoolValue(const char* a_section, const char* a_key, bool a_value);
+
+private:
+	// members
+	std::map<std::pair<std::string, std::string>, std::string> values{};
+};
@@ -0,0 +1,78 @@
+#include "GlobalHistory.h"
+
+#include "Voice.h"
+
+// the Manager members that the history structs and draw code reach, without the menus, blur and HUD of src/GlobalHistory.cpp
+namespace GlobalHistory
+{
+	// no loading or main menu is ever in the way
+	bool Manager::IsValid() const
+	{
+		return true;
+	}
+
+	void Manager::ToggleActive()
+	{
+		if (!IsGlobalHistoryOpen() && !IsValid()) {
+			return;
+		}
+
+		SetGlobalHistoryOpen(!IsGlobalHistoryOpen());
+	}
+
+	bool Manager::IsGlobalHistoryOpen() const
+	{
+		return globalHistoryOpen;
+	}
+
+	void Manager::SetGlobalHistoryOpen(bool a_open, bool)
+	{
+		globalHistoryOpen = a_open;
+		menuOpenedJustNow = a_open;
+
+		if (a_open) {
+			conversationHistory.RefreshHistoryMaps();
+		} else {
+			MANAGER(Voice)->Reset();
+
+			dialogueHistory.ClearCurrentHistory();
+			conversationHistory.ClearCurrentHistory();
+
+			dialogueHistory.ClearFilters();
+			conversationHistory.ClearFilters();
+
+			nameFilter.clear();
+			lastNameFilter.clear();
+		}
+	}
+
+	bool Manager::WasMenuOpenJustNow() const
+	{
+		return menuOpenedJustNow;
+	}
+
+	void Manager::SetMenuOpenJustNow(bool a_open)
+	{
+		menuOpenedJustNow = a_open;
+	}
+
+	bool Manager::Use12HourFormat() const
+	{
+		return use12HourFormat;
+	}
+
+	EventResult Manager::ProcessEvent(const RE::TESLoadGameEvent*, RE::BSTEventSource<RE::TESLoadGameEvent>*)
+	{
+		return EventResult::kContinue;
+	}
+
+	EventResult Manager::ProcessEvent(const RE::TESTopicInfoEvent*, RE::BSTEventSource<RE::TESTopicInfoEvent>*)
+	{
+		return EventResult::kContinue;
+	}
+
+	EventResult Manager::ProcessEvent(const SKSE::ModCallbackEvent*, RE::BSTEventSource<SKSE::ModCallbackEvent>*)
+	{
+		return EventResult::kContinue;
+	}
+}
@@ -0,0 +1,26 @@
+#include "IconsFonts.h"
+
+#include "ImGuiHarness.h"
+
+namespace IconFont
+{
+	std::pair<ImFont*, float> Manager::GetButtonFont() const
+	{
+		return { ImGuiHarness::Stubs::GetFont(), ImGuiHarness::Stubs::GetFontSize() };
+	}
+
+	std::pair<ImFont*, float> Manager::GetHeaderFont() const
+	{
+		return { ImGuiHarness::Stubs::GetFont(), ImGuiHarness::Stubs::GetHeaderFontSize() };
+	}
+
+	std::pair<ImFont*, float> Manager::GetLocalHistoryFont() const
+	{
+		return { ImGuiHarness::Stubs::GetFont(), ImGuiHarness::Stubs::GetFontSize() };
+	}
+
+	std::pair<ImFont*, float> Manager::GetGlobalHistoryFont() const
+	{
+		return { ImGuiHarness::Stubs::GetFont(), ImGuiHarness::Stubs::GetFontSize() };
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+namespace MemoryReport
+{
+	class Report;
+}
+
+// src/ImGui/IconsFonts.h without icons or font files, every font is ImGui's default at the plugin's default sizes
+namespace IconFont
+{
+	struct IconTexture;  // never loaded, every lookup finds nothing
+
+	class Manager final : public REX::Singleton<Manager>
+	{
+	public:
+		void PrefetchIcons() {}
+
+		const IconTexture*           GetIcon(std::uint32_t) { return nullptr; }
+		std::set<const IconTexture*> GetIcons(const std::set<std::uint32_t>&) { return {}; }
+
+		std::pair<ImFont*, float> GetButtonFont() const;
+		std::pair<ImFont*, float> GetHeaderFont() const;
+		std::pair<ImFont*, float> GetLocalHistoryFont() const;
+		std::pair<ImFont*, float> GetGlobalHistoryFont() const;
+	};
+}
@@ -0,0 +1,37 @@
+#include "Styles.h"
+
+namespace ImGui
+{
+	// Styles::Style defaults
+	ImVec4 GetUserStyleColorVec4(USER_STYLE a_style)
+	{
+		switch (a_style) {
+		case USER_STYLE::kButtonColor:
+			return { 0.9843f, 0.9843f, 0.9843f, 1.0f };
+		case USER_STYLE::kSpeakerName:
+			return { 0.208f, 0.784f, 0.992f, 1.0f };
+		case USER_STYLE::kSpeakerLine:
+			return { 1.0f, 1.0f, 1.0f, 1.0f };
+		case USER_STYLE::kPlayerName:
+			return { 0.992f, 0.847f, 0.208f, 1.0f };
+		case USER_STYLE::kPlayerLine:
+			return { 1.0f, 1.0f, 1.0f, 1.0f };
+		default:
+			return ImVec4();
+		}
+	}
+
+	float GetUserStyleVar(USER_STYLE a_style)
+	{
+		switch (a_style) {
+		case USER_STYLE::kButtonScale:
+			return 0.6f;
+		case USER_STYLE::kDisabledTextAlpha:
+			return 0.62f;
+		case USER_STYLE::kSeparatorThickness:
+			return 3.0f;
+		default:
+			return 1.0f;
+		}
+	}
+}
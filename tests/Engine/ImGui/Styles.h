@@ -0,0 +1,20 @@
+#pragma once
+
+// src/ImGui/Styles.h without styles.ini, the user style is the default one
+namespace ImGui
+{
+	enum class USER_STYLE
+	{
+		kButtonScale,
+		kButtonColor,
+		kSpeakerName,
+		kSpeakerLine,
+		kPlayerName,
+		kPlayerLine,
+		kDisabledTextAlpha,
+		kSeparatorThickness,
+	};
+
+	ImVec4 GetUserStyleColorVec4(USER_STYLE a_style);
+	float  GetUserStyleVar(USER_STYLE a_style);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+// the parts of src/LocalHistory.h that input handling reaches, without the dialogue menu. Tests open the menu themselves
+namespace LocalHistory
+{
+	class Manager : public REX::Singleton<Manager>
+	{
+	public:
+		bool IsDialogueMenuOpen() const { return dialogueMenuOpen; }
+		bool IsLocalHistoryOpen() const { return localHistoryOpen; }
+
+		void ToggleActive()
+		{
+			if (IsDialogueMenuOpen()) {
+				SetLocalHistoryOpen(!IsLocalHistoryOpen());
+			}
+		}
+
+		void SetDialogueMenuOpen(bool a_opened) { dialogueMenuOpen = a_opened; }
+		void SetLocalHistoryOpen(bool a_opened) { localHistoryOpen = a_opened; }
+
+	private:
+		// members
+		bool dialogueMenuOpen{ false };
+		bool localHistoryOpen{ false };
+	};
+}
@@ -0,0 +1,73 @@
+#include "NPCNameProvider.h"
+
+std::string NPCNameProvider::GetName(RE::TESObjectREFR* a_ref)
+{
+	if (a_ref->IsPlayerRef()) {
+		return a_ref->GetDisplayFullName();
+	}
+
+	auto [it, inserted] = names.try_emplace(a_ref->GetFormID());
+	if (inserted || !it->second) {
+		resolveCount++;
+		it->second = a_ref->GetDisplayFullName();
+	}
+
+	return *it->second;
+}
+
+std::optional<std::string> NPCNameProvider::GetName(RE::FormID a_formID)
+{
+	if (const auto it = names.find(a_formID); it != names.end()) {
+		return it->second;
+	}
+
+	auto actor = RE::TESForm::LookupByID<RE::Actor>(a_formID);
+	if (!actor) {
+		names.emplace(a_formID, std::nullopt);
+		return std::nullopt;
+	}
+
+	return GetName(actor);
+}
+
+std::string NPCNameProvider::GetLocationName(RE::TESForm* a_cellOrLoc)
+{
+	if (!a_cellOrLoc) {
+		return "$DH_UnknownLocation"_T;
+	}
+
+	auto [it, inserted] = locationNames.try_emplace(a_cellOrLoc->GetFormID());
+	if (inserted) {
+		resolveCount++;
+		it->second = a_cellOrLoc->GetName();
+		if (it->second.empty()) {
+			it->second = "$DH_UnknownLocation"_T;
+		}
+	}
+
+	return it->second;
+}
+
+std::string NPCNameProvider::GetLocationName(RE::FormID a_formID)
+{
+	if (const auto it = locationNames.find(a_formID); it != locationNames.end()) {
+		return it->second;
+	}
+
+	if (auto cellOrLoc = RE::TESForm::LookupByID(a_formID)) {
+		return GetLocationName(cellOrLoc);
+	}
+
+	return locationNames.emplace(a_formID, "???").first->second;
+}
+
+void NPCNameProvider::InvalidateName(RE::FormID a_formID)
+{
+	names.erase(a_formID);
+}
+
+void NPCNameProvider::ClearCache()
+{
+	names.clear();
+	locationNames.clear();
+}
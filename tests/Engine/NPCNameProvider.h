@@ -0,0 +1,29 @@
+#pragma once
+
+namespace MemoryReport
+{
+	class Report;
+}
+
+// src/NPCNameProvider.h without NND, names come from the forms a test created. Resolutions are counted so
+// benchmarks can tell cached lookups from form lookups
+class NPCNameProvider : public REX::Singleton<NPCNameProvider>
+{
+public:
+	std::string                GetName(RE::TESObjectREFR* a_ref);
+	std::optional<std::string> GetName(RE::FormID a_formID);  // nullopt if the actor no longer exists
+
+	std::string GetLocationName(RE::TESForm* a_cellOrLoc);
+	std::string GetLocationName(RE::FormID a_formID);
+
+	void InvalidateName(RE::FormID a_formID);
+	void ClearCache();
+
+	std::size_t GetResolveCount() const { return resolveCount; }
+
+private:
+	// members
+	Map<RE::FormID, std::optional<std::string>> names;
+	Map<RE::FormID, std::string>                locationNames;
+	std::size_t                                 resolveCount{ 0 };
+};
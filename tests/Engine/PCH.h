@@ -0,0 +1,49 @@
+#pragma once
+
+// stands in for src/PCH.h, with the plugin's ImGui and glaze and Engine.h in place of CommonLibSSE and the other game libraries
+
+#include "../PCH.h"
+
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <format>
+#include <unordered_map>
+
+#include <glaze/glaze.hpp>
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#define MANAGER(T) T::Manager::GetSingleton()
+
+#include "Engine.h"
+
+using namespace clib_util;
+
+namespace logger = SKSE::log;
+
+using EventResult = RE::BSEventNotifyControl;
+
+using KEY = RE::BSWin32KeyboardDevice::Key;
+using GAMEPAD_DIRECTX = RE::BSWin32GamepadDevice::Key;
+using GAMEPAD_ORBIS = RE::BSPCOrbisGamepadDevice::Key;
+using MOUSE = RE::BSWin32MouseDevice::Key;
+
+template <class K, class D>
+using Map = std::unordered_map<K, D>;
+
+struct string_hash
+{
+	using is_transparent = void;  // enable heterogeneous overloads
+
+	[[nodiscard]] std::size_t operator()(std::string_view str) const noexcept
+	{
+		return std::hash<std::string_view>{}(str);
+	}
+};
+
+template <class D>
+using StringMap = std::unordered_map<std::string, D, string_hash, std::equal_to<>>;
+
+#include "Translation.h"
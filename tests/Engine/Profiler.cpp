@@ -0,0 +1,11 @@
+#include "Profiler.h"
+
+// tracing is never turned on off the game, spans only keep their name
+namespace Profiler
+{
+	TraceSpan::TraceSpan(const char* a_name) :
+		name(a_name)
+	{}
+
+	TraceSpan::~TraceSpan() = default;
+}
@@ -0,0 +1,42 @@
+#include "Voice.h"
+
+#include "Dialogue.h"
+
+namespace Voice
+{
+	SoundID NullBackend::Build(const std::string& a_path)
+	{
+		return a_path.empty() ? 0 : nextID++;
+	}
+
+	void Manager::Prefetch(const std::string& a_voice)
+	{
+		player.Hover(a_voice, Player::clock::now());
+	}
+
+	void Manager::Play(const std::string& a_voice)
+	{
+		player.Play(a_voice);
+	}
+
+	void Manager::PlayConversation(const Dialogue& a_dialogue)
+	{
+		std::vector<std::string> voices;
+		voices.reserve(a_dialogue.dialogue.size());
+		for (const auto& line : a_dialogue.dialogue) {
+			voices.push_back(line.voice);
+		}
+
+		player.PlayConversation(std::move(voices));
+	}
+
+	void Manager::Update()
+	{
+		player.Update(Player::clock::now());
+	}
+
+	void Manager::Reset()
+	{
+		player.Reset();
+	}
+}
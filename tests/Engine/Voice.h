@@ -0,0 +1,42 @@
+#pragma once
+
+#include "VoicePlayer.h"
+
+struct Dialogue;
+
+// src/Voice.h over a backend that never reads a file, the player's prefetch and queue logic is the plugin's own
+namespace Voice
+{
+	class NullBackend : public IVoiceBackend
+	{
+	public:
+		SoundID Build(const std::string& a_path) override;
+		void    Play(SoundID) override {}
+		bool    IsPlaying(SoundID) const override { return false; }
+		void    Release(SoundID) override {}
+
+		std::size_t GetBuildCount() const { return nextID - 1; }
+
+	private:
+		// members
+		SoundID nextID{ 1 };
+	};
+
+	class Manager : public REX::Singleton<Manager>
+	{
+	public:
+		void Prefetch(const std::string& a_voice);  // every frame the line is hovered
+		void Play(const std::string& a_voice);
+		void PlayConversation(const Dialogue& a_dialogue);
+
+		void Update();
+		void Reset();
+
+		const NullBackend& GetBackend() const { return backend; }
+
+	private:
+		// members
+		NullBackend backend{};
+		Player      player{ backend };
+	};
+}
@@ -0,0 +1,51 @@
+#include "GlobalHistory.h"
+#include "HistoryStubs.h"
+
+#include <benchmark/benchmark.h>
+
+// the saved history files through the glaze metadata of Dialogue.h and GlobalHistory.h, as SaveHistoryToFileImpl
+// writes them and LoadHistoryFromFileImpl reads them, without the file itself
+namespace
+{
+	using namespace GlobalHistory;
+
+	template <class T>
+	using File = HistoryFile<std::vector<T>>;
+
+	template <class T>
+	void BM_WriteHistory(benchmark::State& a_state)
+	{
+		const File<T> file{ {}, Stubs::MakeHistory<T>(static_cast<std::size_t>(a_state.range(0))) };
+
+		std::string buffer;
+		for (auto _ : a_state) {
+			buffer.clear();
+			static_cast<void>(glz::write_json(file, buffer));
+			benchmark::DoNotOptimize(buffer.data());
+		}
+		a_state.SetBytesProcessed(a_state.iterations() * static_cast<std::int64_t>(buffer.size()));
+	}
+
+	template <class T>
+	void BM_ReadHistory(benchmark::State& a_state)
+	{
+		std::string buffer;
+		static_cast<void>(glz::write_json(File<T>{ {}, Stubs::MakeHistory<T>(static_cast<std::size_t>(a_state.range(0))) }, buffer));
+
+		File<T> file;
+		for (auto _ : a_state) {
+			file = {};
+			if (glz::read_json(file, buffer)) {
+				a_state.SkipWithError("read_json failed");
+				break;
+			}
+			benchmark::DoNotOptimize(file.history.data());
+		}
+		a_state.SetBytesProcessed(a_state.iterations() * static_cast<std::int64_t>(buffer.size()));
+	}
+}
+
+BENCHMARK_TEMPLATE(BM_WriteHistory, Dialogue)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ReadHistory, Dialogue)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_WriteHistory, Monologue)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ReadHistory, Monologue)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,149 @@
+#include "GlobalHistory.h"
+#include "HistoryStubs.h"
+#include "NPCNameProvider.h"
+
+#include <benchmark/benchmark.h>
+
+// the history bookkeeping outside of drawing: SaveHistory as conversations end, RefreshHistoryMaps each time the
+// menu opens, and InitHistory after a load, resolving names through the stand-in NPCNameProvider or the saved snapshot
+namespace
+{
+	using namespace GlobalHistory;
+
+	// the speakers and locations of Stubs::MakeHistory as forms, so every entry resolves
+	class World
+	{
+	public:
+		World()
+		{
+			for (std::size_t i = 0; i < Stubs::speakers.size(); i++) {
+				actors.emplace_back(speakerBase + static_cast<RE::FormID>(i), std::string(Stubs::speakers[i]));
+			}
+			for (std::size_t i = 0; i < Stubs::locations.size(); i++) {
+				locations.emplace_back(locationBase + static_cast<RE::FormID>(i), std::string(Stubs::locations[i]));
+			}
+		}
+
+		// entries spoken by the actor of the same name, in the location of the same name
+		template <class T>
+		static std::vector<T> MakeHistory(std::size_t a_count)
+		{
+			auto history = Stubs::MakeHistory<T>(a_count);
+			for (auto& entry : history) {
+				const auto speaker = std::ranges::find(Stubs::speakers, entry.speakerName) - Stubs::speakers.begin();
+				const auto location = std::ranges::find(Stubs::locations, entry.locName) - Stubs::locations.begin();
+				entry.id.SetNumericID(speakerBase + static_cast<RE::FormID>(speaker));
+				entry.loc.SetNumericID(locationBase + static_cast<RE::FormID>(location));
+			}
+			return history;
+		}
+
+	private:
+		static constexpr RE::FormID speakerBase{ 0x0A0000 };
+		static constexpr RE::FormID locationBase{ 0x0B0000 };
+
+		// members
+		std::deque<RE::Actor>       actors;  // forms register their address, a deque never moves them
+		std::deque<RE::BGSLocation> locations;
+	};
+
+	template <class T>
+	std::vector<std::tm> GetTimes(const std::vector<T>& a_history)
+	{
+		std::vector<std::tm> times;
+		times.reserve(a_history.size());
+		for (const auto& entry : a_history) {
+			times.push_back(entry.ExtractTimeStamp());
+		}
+		return times;
+	}
+
+	// a_count conversations ending one after another, into an empty history
+	void BM_DialogueSaveHistory(benchmark::State& a_state)
+	{
+		const auto history = World::MakeHistory<Dialogue>(static_cast<std::size_t>(a_state.range(0)));
+		const auto times = GetTimes(history);
+
+		for (auto _ : a_state) {
+			DialogueHistory dialogueHistory;
+			for (std::size_t i = 0; i < history.size(); i++) {
+				dialogueHistory.SaveHistory(times[i], history[i], false);
+			}
+			benchmark::DoNotOptimize(dialogueHistory.dateMap.map.size());
+		}
+		a_state.SetItemsProcessed(static_cast<std::int64_t>(a_state.iterations() * history.size()));
+	}
+
+	// with the menu open, so the maps are kept up to date as well
+	void BM_ConversationSaveHistory(benchmark::State& a_state)
+	{
+		const auto history = World::MakeHistory<Monologue>(static_cast<std::size_t>(a_state.range(0)));
+		const auto times = GetTimes(history);
+
+		MANAGER(GlobalHistory)->SetGlobalHistoryOpen(true);
+		for (auto _ : a_state) {
+			ConversationHistory conversationHistory;
+			for (std::size_t i = 0; i < history.size(); i++) {
+				conversationHistory.SaveHistory(times[i], history[i]);
+			}
+			benchmark::DoNotOptimize(conversationHistory.dateMap.map.size());
+		}
+		MANAGER(GlobalHistory)->SetGlobalHistoryOpen(false);
+
+		a_state.SetItemsProcessed(static_cast<std::int64_t>(a_state.iterations() * history.size()));
+	}
+
+	void BM_RefreshHistoryMaps(benchmark::State& a_state)
+	{
+		ConversationHistory conversationHistory;
+		conversationHistory.history.monologues = World::MakeHistory<Monologue>(static_cast<std::size_t>(a_state.range(0)));
+
+		for (auto _ : a_state) {
+			conversationHistory.RefreshHistoryMaps();
+			benchmark::DoNotOptimize(conversationHistory.dateMap.map.size());
+		}
+		a_state.SetItemsProcessed(static_cast<std::int64_t>(a_state.iterations() * conversationHistory.history.monologues.size()));
+	}
+
+	// a freshly loaded file, the name cache cleared as on kPreLoadGame. Range 1 picks whether the file carries a
+	// trusted name snapshot. The resolves counter is the name provider's form lookups per load
+	template <class History, class T>
+	void BM_InitHistory(benchmark::State& a_state)
+	{
+		World world;
+
+		const auto loaded = World::MakeHistory<T>(static_cast<std::size_t>(a_state.range(0)));
+		const auto names = a_state.range(1) ? NameSnapshot::Create(loaded) : NameSnapshot{};
+
+		const auto nameProvider = NPCNameProvider::GetSingleton();
+
+		History     history;
+		std::size_t resolves = 0;
+		for (auto _ : a_state) {
+			a_state.PauseTiming();
+			history.Clear();
+			if constexpr (std::is_same_v<History, ConversationHistory>) {
+				history.history.monologues = loaded;
+			} else {
+				history.history = loaded;
+			}
+			history.names = names;
+			nameProvider->ClearCache();
+			const auto resolved = nameProvider->GetResolveCount();
+			a_state.ResumeTiming();
+
+			history.InitHistory();
+
+			resolves += nameProvider->GetResolveCount() - resolved;
+		}
+
+		a_state.counters["resolves"] = benchmark::Counter(static_cast<double>(resolves), benchmark::Counter::kAvgIterations);
+		a_state.SetItemsProcessed(static_cast<std::int64_t>(a_state.iterations() * loaded.size()));
+	}
+}
+
+BENCHMARK(BM_DialogueSaveHistory)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConversationSaveHistory)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RefreshHistoryMaps)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_InitHistory, DialogueHistory, Dialogue)->ArgsProduct({ { 1000, 10000, 100000 }, { 0, 1 } })->ArgNames({ "entries", "snapshot" })->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_InitHistory, ConversationHistory, Monologue)->ArgsProduct({ { 1000, 10000, 100000 }, { 0, 1 } })->ArgNames({ "entries", "snapshot" })->Unit(benchmark::kMillisecond);
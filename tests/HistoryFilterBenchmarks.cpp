@@ -0,0 +1,29 @@
+#include "HistoryFilter.h"
+#include "HistoryStubs.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+	using namespace Stubs;
+
+	// get_map on a new filter: copy the full map, then filter the copy
+	template <class Map, class History>
+	void BM_FilterHistory(benchmark::State& a_state, Map (*a_makeMap)(const History&), std::string_view a_filter)
+	{
+		const auto map = a_makeMap(MakeHistory<typename History::value_type>(static_cast<std::size_t>(a_state.range(0))));
+
+		for (auto _ : a_state) {
+			auto filteredMap = map;
+			GlobalHistory::FilterHistory(filteredMap, [&](const std::string& a_speakerName) {
+				return icontains(a_speakerName, a_filter);
+			});
+			benchmark::DoNotOptimize(filteredMap);
+		}
+		a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+	}
+}
+
+BENCHMARK_CAPTURE(BM_FilterHistory, DialogueDate, &MakeDialogueDate, "lyd"sv)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_FilterHistory, DialogueDateNoMatch, &MakeDialogueDate, "alduin"sv)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_FilterHistory, MonologueLocation, &MakeMonologueLocation, "lyd"sv)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
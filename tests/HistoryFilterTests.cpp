@@ -0,0 +1,142 @@
+#include "HistoryFilter.h"
+#include "HistoryStubs.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+	using namespace Stubs;
+
+	auto Keep(std::string_view a_filter)
+	{
+		return [a_filter](const std::string& a_speakerName) {
+			return icontains(a_speakerName, a_filter);
+		};
+	}
+
+	template <class Map>
+	std::size_t CountLeaves(const Map& a_map)
+	{
+		std::size_t count = 0;
+		for (const auto& [key, leaf] : a_map) {
+			if constexpr (requires { leaf.monologues; }) {
+				count += leaf.monologues.size();
+			} else if constexpr (requires { leaf.speakerName; }) {
+				count++;
+			} else {
+				count += CountLeaves(leaf);
+			}
+		}
+		return count;
+	}
+
+	template <class Map, class F>
+	void ForEachSpeaker(const Map& a_map, F&& a_func)
+	{
+		for (const auto& [key, leaf] : a_map) {
+			if constexpr (requires { leaf.monologues; }) {
+				for (const auto& monologue : leaf.monologues) {
+					a_func(monologue.speakerName);
+				}
+			} else if constexpr (requires { leaf.speakerName; }) {
+				a_func(leaf.speakerName);
+			} else {
+				ForEachSpeaker(leaf, a_func);
+			}
+		}
+	}
+}
+
+TEST(HistoryFilter, KeepsMatchingDialogue)
+{
+	const auto history = MakeHistory<Dialogue>(500);
+	auto       map = MakeDialogueDate(history);
+
+	const auto expected = std::ranges::count_if(history, [](const auto& a_dialogue) { return icontains(a_dialogue.speakerName, "lyd"); });
+
+	GlobalHistory::FilterHistory(map, Keep("lyd"));
+
+	EXPECT_GT(expected, 0);
+	EXPECT_EQ(CountLeaves(map), static_cast<std::size_t>(expected));
+	ForEachSpeaker(map, [](const std::string& a_name) { EXPECT_EQ(a_name, "Lydia"); });
+}
+
+TEST(HistoryFilter, DropsEmptyBranches)
+{
+	auto map = MakeDialogueDate(MakeHistory<Dialogue>(500));
+
+	GlobalHistory::FilterHistory(map, Keep("Lydia"));
+
+	for (const auto& [day, dialogues] : map) {
+		EXPECT_FALSE(dialogues.empty());
+	}
+}
+
+TEST(HistoryFilter, NoMatchEmptiesMap)
+{
+	auto dialogueMap = MakeDialogueDate(MakeHistory<Dialogue>(100));
+	auto monologueMap = MakeMonologueLocation(MakeHistory<Monologue>(100));
+
+	GlobalHistory::FilterHistory(dialogueMap, Keep("Alduin"));
+	GlobalHistory::FilterHistory(monologueMap, Keep("Alduin"));
+
+	EXPECT_TRUE(dialogueMap.empty());
+	EXPECT_TRUE(monologueMap.empty());
+}
+
+TEST(HistoryFilter, FiltersMonologuesInsideLists)
+{
+	const auto history = MakeHistory<Monologue>(500);
+	auto       map = MakeMonologueLocation(history);
+
+	const auto expected = std::ranges::count_if(history, [](const auto& a_monologue) { return icontains(a_monologue.speakerName, "BATTLE-BORN"); });
+
+	GlobalHistory::FilterHistory(map, Keep("BATTLE-BORN"));
+
+	EXPECT_EQ(CountLeaves(map), static_cast<std::size_t>(expected));
+	ForEachSpeaker(map, [](const std::string& a_name) { EXPECT_TRUE(a_name.ends_with("Battle-Born")); });
+}
+
+TEST(HistoryFilter, MatchAllKeepsEverything)
+{
+	auto       map = MakeDialogueDate(MakeHistory<Dialogue>(300));
+	const auto before = CountLeaves(map);
+
+	GlobalHistory::FilterHistory(map, [](const std::string&) { return true; });
+
+	EXPECT_EQ(CountLeaves(map), before);
+}
+
+TEST(TimeStampKey, MatchesDigitLayout)
+{
+	std::tm time{};
+	time.tm_year = 201;
+	time.tm_mon = 7;
+	time.tm_mday = 17;
+	time.tm_hour = 13;
+	time.tm_min = 5;
+
+	EXPECT_EQ(TimeStampKey::Generate(time), 20107171305ull);
+}
+
+TEST(TimeStampKey, RoundTrips)
+{
+	for (const auto& dialogue : MakeHistory<Dialogue>(2000)) {
+		EXPECT_EQ(TimeStampKey::Generate(TimeStampKey::Extract(dialogue.timeStamp)), dialogue.timeStamp);
+	}
+}
+
+TEST(TimeStampKey, OrdersByDateThenTime)
+{
+	std::tm earlier{};
+	earlier.tm_year = 201;
+	earlier.tm_mon = 11;
+	earlier.tm_mday = 31;
+	earlier.tm_hour = 23;
+	earlier.tm_min = 59;
+
+	std::tm later{};
+	later.tm_year = 202;
+
+	EXPECT_LT(TimeStampKey::Generate(earlier), TimeStampKey::Generate(later));
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "TimeStampKey.h"
+
+// the history data model without its engine parts, same members and map layouts as Dialogue.h and GlobalHistory.h
+namespace Stubs
+{
+	struct NumericID
+	{
+		std::uint8_t data1{ 0 };
+		std::uint8_t data2{ 0 };
+		std::uint8_t data3{ 0 };
+	};
+
+	struct SpeechLine
+	{
+		std::string line;
+		std::string voice;
+		bool        hovered{};
+	};
+
+	struct DialogueLine : SpeechLine
+	{
+		std::string name{};
+		bool        isPlayer{};
+	};
+
+	struct Speech
+	{
+		std::uint64_t timeStamp{};
+		NumericID     id{};
+		NumericID     loc{};
+		std::string   locName{};
+		std::string   speakerName{};
+	};
+
+	struct Dialogue : Speech
+	{
+		std::string               playerName{};
+		std::vector<DialogueLine> dialogue{};
+		std::string               timeAndLoc{};
+	};
+
+	struct Monologue : Speech
+	{
+		SpeechLine   line{};
+		NumericID    topic{};
+		std::int32_t dialogueType{ -1 };
+		std::string  hourMinTimeStamp{};
+	};
+
+	struct Monologues
+	{
+		std::vector<Monologue> monologues{};
+	};
+
+	struct TimeStamp
+	{
+		bool operator<(const TimeStamp& a_rhs) const { return time < a_rhs.time; }
+		bool operator>(const TimeStamp& a_rhs) const { return time > a_rhs.time; }
+
+		// members
+		std::uint64_t time{};
+		std::string   format{};
+	};
+
+	struct comparator
+	{
+		bool operator()(const TimeStamp& a_lhs, const TimeStamp& a_rhs) const { return a_lhs > a_rhs; }
+		bool operator()(const std::string& a_lhs, const std::string& a_rhs) const { return a_lhs < a_rhs; }
+	};
+
+	template <class D>
+	using TimeStampMap = std::map<TimeStamp, D, comparator>;
+
+	using DialogueDate = TimeStampMap<TimeStampMap<Dialogue>>;
+	using DialogueLocation = std::map<std::string, TimeStampMap<Dialogue>, comparator>;
+
+	using MonologueDate = TimeStampMap<Monologues>;
+	using MonologueLocation = std::map<std::string, TimeStampMap<Monologues>, comparator>;
+
+	// same matching as ClibUtil's string::icontains
+	inline bool icontains(std::string_view a_str, std::string_view a_substr)
+	{
+		const auto match = std::ranges::search(a_str, a_substr, [](char a_lhs, char a_rhs) {
+			return std::toupper(static_cast<unsigned char>(a_lhs)) == std::toupper(static_cast<unsigned char>(a_rhs));
+		});
+		return !match.empty() || a_substr.empty();
+	}
+
+	inline constexpr std::array speakers{
+		"Lydia"sv, "Belethor"sv, "Adrianne Avenicci"sv, "Farengar Secret-Fire"sv, "Jarl Balgruuf the Greater"sv,
+		"Hulda"sv, "Ysolda"sv, "Nazeem"sv, "Heimskr"sv, "Brenuin"sv, "Irileth"sv, "Proventus Avenicci"sv,
+		"Arcadia"sv, "Olfrid Battle-Born"sv, "Idolaf Battle-Born"sv, "Uthgerd the Unbroken"sv
+	};
+
+	inline constexpr std::array locations{
+		"Whiterun"sv, "Dragonsreach"sv, "The Bannered Mare"sv, "Riverwood"sv, "Solitude"sv, "Windhelm"sv, "Markarth"sv, "Riften"sv
+	};
+
+	// a_count entries spread over a few per game day, same seed gives the same history. Also fills the plugin's own
+	// Dialogue and Monologue, which share these member names
+	template <class T>
+	std::vector<T> MakeHistory(std::size_t a_count, std::uint32_t a_seed = 1)
+	{
+		std::mt19937                               rng(a_seed);
+		std::uniform_int_distribution<std::size_t> speaker(0, speakers.size() - 1);
+		std::uniform_int_distribution<std::size_t> location(0, locations.size() - 1);
+		std::uniform_int_distribution<int>         lineCount(2, 12);
+
+		std::vector<T> history(a_count);
+		for (std::size_t i = 0; i < a_count; i++) {
+			auto& entry = history[i];
+
+			std::tm time{};
+			time.tm_year = 201 + static_cast<int>(i / 2000);
+			time.tm_mon = static_cast<int>(i / 160 % 12);
+			time.tm_mday = 1 + static_cast<int>(i / 5 % 30);
+			time.tm_hour = static_cast<int>(i % 5 * 4);
+			time.tm_min = static_cast<int>(i % 60);
+
+			entry.timeStamp = TimeStampKey::Generate(time);
+			entry.id = { static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i >> 8), static_cast<std::uint8_t>(i >> 16) };
+			entry.loc = { static_cast<std::uint8_t>(location(rng)), 0, 0 };
+			entry.locName = locations[entry.loc.data1];
+			entry.speakerName = speakers[speaker(rng)];
+
+			if constexpr (requires { entry.dialogue; }) {
+				entry.playerName = "Prisoner";
+				entry.dialogue.resize(lineCount(rng));
+				for (std::size_t j = 0; j < entry.dialogue.size(); j++) {
+					auto& line = entry.dialogue[j];
+					line.isPlayer = j % 2 == 1;
+					line.name = line.isPlayer ? entry.playerName : entry.speakerName;
+					line.line = "I used to be an adventurer like you, then I took an arrow in the knee.";
+					line.voice = "Sound/Voice/Skyrim.esm/MaleNord/DialogueGe_0001A2B3_1.fuz";
+				}
+			} else {
+				entry.line.line = "Let me guess... someone stole your sweetroll.";
+				entry.line.voice = "Sound/Voice/Skyrim.esm/FemaleEvenToned/DialogueGe_0001A2B3_1.fuz";
+				entry.topic = { static_cast<std::uint8_t>(i), 1, 0 };
+				entry.dialogueType = 1;
+			}
+		}
+		return history;
+	}
+
+	// the date and location maps InitHistory builds, keyed by day then time. Labels carry "##id" like TimeStamp::format
+	inline DialogueDate MakeDialogueDate(const std::vector<Dialogue>& a_history)
+	{
+		DialogueDate map;
+		for (const auto& dialogue : a_history) {
+			const auto time = TimeStampKey::Extract(dialogue.timeStamp);
+			const auto day = dialogue.timeStamp / 10000;
+			map[{ day, std::to_string(time.tm_mday) + "##" + std::to_string(day) }][{ dialogue.timeStamp, dialogue.speakerName + "##" + std::to_string(dialogue.timeStamp) }] = dialogue;
+		}
+		return map;
+	}
+
+	inline MonologueLocation MakeMonologueLocation(const std::vector<Monologue>& a_history)
+	{
+		MonologueLocation map;
+		for (const auto& monologue : a_history) {
+			const auto hour = monologue.timeStamp / 100;
+			map[monologue.locName][{ hour, monologue.locName + "##" + std::to_string(hour) }].monologues.push_back(monologue);
+		}
+		return map;
+	}
+}
@@ -0,0 +1,279 @@
+#include "HistoryViews.h"
+#include "ImGui/Styles.h"
+#include "ImGuiHarness.h"
+#include "Voice.h"
+
+#include <benchmark/benchmark.h>
+
+// the plugin's Monologues::Draw, Dialogue::Draw and history tree templates, built against tests/Engine and fed
+// generated histories. The table views are the draw code the row widget replaced, kept as a baseline
+namespace
+{
+	using namespace GlobalHistory;
+	using namespace HistoryViews;
+
+	constexpr ImVec2 mousePos{ 960.0f, 200.0f };  // over the first rows, so the hover paths run
+
+	ImVec4 WithAlpha(ImVec4 a_color, float a_alpha)
+	{
+		a_color.w = a_alpha;
+		return a_color;
+	}
+
+	// ImGui::TextColoredWrapped, removed from Util along with the tables
+	void TextColoredWrapped(const ImVec4& a_color, const char* a_text)
+	{
+		ImGui::PushStyleColor(ImGuiCol_Text, a_color);
+		ImGui::PushTextWrapPos(0.0f);
+		ImGui::TextUnformatted(a_text);
+		ImGui::PopTextWrapPos();
+		ImGui::PopStyleColor();
+	}
+
+	// Monologues::Draw before the row widget, a 4 column table with a Text call per cell
+	struct MonologueTableView
+	{
+		void Draw()
+		{
+			if (nameWidth == 0.0f) {
+				timeWidth = ImGui::CalcTextSize("88:88").x;
+				for (const auto& monologue : history.monologues) {
+					nameWidth = std::max(nameWidth, ImGui::CalcTextSize(monologue.speakerName.c_str()).x);
+				}
+				colonWidth = ImGui::CalcTextSize(":").x;
+			}
+
+			ImGui::PushStyleColor(ImGuiCol_ChildBg, ImVec4());
+
+			if (ImGui::BeginTable("##Logs", 4, ImGuiTableFlags_ScrollY)) {
+				ImGui::TableSetupColumn("##Time", ImGuiTableColumnFlags_WidthFixed, timeWidth);
+				ImGui::TableSetupColumn("##Name", ImGuiTableColumnFlags_WidthFixed, nameWidth);
+				ImGui::TableSetupColumn("##Colon", ImGuiTableColumnFlags_WidthFixed, colonWidth);
+				ImGui::TableSetupColumn("##Line", ImGuiTableColumnFlags_WidthStretch);
+
+				const auto speakerColor = ImGui::GetUserStyleColorVec4(ImGui::USER_STYLE::kSpeakerName);
+
+				for (auto& monologue : history.monologues | std::views::reverse) {
+					if (monologue.hourMinTimeStamp.empty()) {
+						const auto tm = monologue.ExtractTimeStamp();
+						monologue.hourMinTimeStamp = TimeStamp::GetFormattedHourMin(tm.tm_hour, tm.tm_min, false);
+					}
+
+					auto& [response, voice, hovered] = monologue.line;
+
+					ImGui::TableNextRow();
+					ImGui::TableSetColumnIndex(0);
+					{
+						ImGui::TextUnformatted(monologue.hourMinTimeStamp.c_str());
+					}
+					ImGui::TableSetColumnIndex(1);
+					{
+						ImGui::TextColored(speakerColor, "%s", monologue.speakerName.c_str());
+					}
+					ImGui::TableSetColumnIndex(2);
+					{
+						ImGui::TextColored(speakerColor, ":");
+					}
+					ImGui::TableSetColumnIndex(3);
+					{
+						const auto lineColor = WithAlpha(ImGui::GetUserStyleColorVec4(ImGui::USER_STYLE::kSpeakerLine), hovered ? 1.0f : ImGui::GetUserStyleVar(ImGui::USER_STYLE::kDisabledTextAlpha));
+						TextColoredWrapped(lineColor, response.c_str());
+
+						hovered = ImGui::IsItemHovered();
+						if (hovered) {
+							MANAGER(Voice)->Prefetch(voice);
+						}
+						if (ImGui::IsItemSelected()) {
+							MANAGER(Voice)->Play(voice);
+						}
+					}
+					ImGui::Spacing(3);
+				}
+				ImGui::EndTable();
+			}
+
+			ImGui::PopStyleColor();
+		}
+
+		// members
+		Monologues history;
+		float      timeWidth{ 0.0f };
+		float      nameWidth{ 0.0f };
+		float      colonWidth{ 0.0f };
+	};
+
+	// Dialogue::Draw before the row widget, a 3 column table with a Text call per cell
+	struct DialogueTableView
+	{
+		void Draw()
+		{
+			if (nameWidth == 0.0f) {
+				nameWidth = std::max(ImGui::CalcTextSize(dialogue.playerName.c_str()).x, ImGui::CalcTextSize(dialogue.speakerName.c_str()).x);
+				colonWidth = ImGui::CalcTextSize(":").x;
+			}
+
+			ImGui::Indent();
+			{
+				auto [headerFont, headerFontSize] = MANAGER(IconFont)->GetHeaderFont();
+				ImGui::PushFont(headerFont, headerFontSize);
+				{
+					ImGui::CenteredText(dialogue.speakerName.c_str(), false);
+				}
+				ImGui::PopFont();
+				if (dialogue.timeAndLoc.empty()) {
+					dialogue.timeAndLoc = std::format("{} - {}", dialogue.TimeStampToString(false), dialogue.locName);
+				}
+				ImGui::CenteredText(dialogue.timeAndLoc.c_str(), false);
+
+				const auto label = "$DH_ReplayConversation_Button"_T;
+				ImGui::AlignForWidth(ImGui::CalcTextSize(label).x + ImGui::GetStyle().FramePadding.x * 2);
+				if (ImGui::SmallButton(label)) {
+					MANAGER(Voice)->PlayConversation(dialogue);
+				}
+				ImGui::Spacing(4);
+
+				ImGui::PushStyleColor(ImGuiCol_ChildBg, ImVec4());
+
+				if (ImGui::BeginTable("##DialogueLogs", 3, ImGuiTableFlags_ScrollY)) {
+					ImGui::TableSetupColumn("##Name", ImGuiTableColumnFlags_WidthFixed, nameWidth);
+					ImGui::TableSetupColumn("##Colon", ImGuiTableColumnFlags_WidthFixed, colonWidth);
+					ImGui::TableSetupColumn("##Line", ImGuiTableColumnFlags_WidthStretch);
+
+					for (auto& line : dialogue.dialogue) {
+						const auto speakerColor = ImGui::GetUserStyleColorVec4(line.isPlayer ? ImGui::USER_STYLE::kPlayerName : ImGui::USER_STYLE::kSpeakerName);
+
+						ImGui::TableNextRow();
+						ImGui::TableSetColumnIndex(0);
+						{
+							ImGui::TextColored(speakerColor, "%s", line.name.c_str());
+						}
+						ImGui::TableSetColumnIndex(1);
+						{
+							ImGui::TextColored(speakerColor, ":");
+						}
+						ImGui::TableSetColumnIndex(2);
+						{
+							const auto lineStyle = line.isPlayer ? ImGui::USER_STYLE::kPlayerLine : ImGui::USER_STYLE::kSpeakerLine;
+							const auto lineColor = WithAlpha(ImGui::GetUserStyleColorVec4(lineStyle), (line.isPlayer || line.hovered) ? 1.0f : ImGui::GetUserStyleVar(ImGui::USER_STYLE::kDisabledTextAlpha));
+							TextColoredWrapped(lineColor, line.line.c_str());
+
+							line.hovered = ImGui::IsItemHovered();
+							if (line.hovered) {
+								MANAGER(Voice)->Prefetch(line.voice);
+							}
+							if (ImGui::IsItemSelected()) {
+								MANAGER(Voice)->Play(line.voice);
+							}
+						}
+						ImGui::Spacing(3);
+					}
+					ImGui::EndTable();
+				}
+
+				ImGui::PopStyleColor();
+			}
+			ImGui::Unindent();
+		}
+
+		// members
+		Dialogue dialogue;
+		float    nameWidth{ 0.0f };
+		float    colonWidth{ 0.0f };
+	};
+
+	template <class F>
+	void RunFrames(benchmark::State& a_state, F&& a_draw)
+	{
+		if (!LoadTranslations()) {
+			a_state.SkipWithError("Unable to read " TRANSLATIONS_DIR "/DialogueHistory_ENGLISH.txt");
+			return;
+		}
+
+		ImGuiHarness::NullBackend backend;
+		backend.SetMousePos(mousePos);
+
+		MANAGER(GlobalHistory)->SetGlobalHistoryOpen(true);
+
+		const auto draw = [&] { DrawWindow(a_draw); };
+
+		// settle layout, glyph baking and window state before timing
+		for (int i = 0; i < 3; i++) {
+			backend.Frame(draw);
+		}
+
+		ImGuiHarness::FrameStats stats;
+		std::size_t              allocations = 0;
+		for (auto _ : a_state) {
+			stats = backend.Frame(draw);
+			allocations += stats.allocations;
+		}
+
+		MANAGER(GlobalHistory)->SetGlobalHistoryOpen(false);
+
+		a_state.counters["vertices"] = static_cast<double>(stats.vertices);
+		a_state.counters["indices"] = static_cast<double>(stats.indices);
+		a_state.counters["drawCalls"] = static_cast<double>(stats.drawCalls);
+		a_state.counters["allocations"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+	}
+
+	void BM_DrawMonologueLog(benchmark::State& a_state)
+	{
+		auto history = MakeMonologues(static_cast<std::size_t>(a_state.range(0)));
+		RunFrames(a_state, [&] { history.Draw(); });
+	}
+
+	void BM_DrawDialogueLog(benchmark::State& a_state)
+	{
+		auto dialogue = MakeDialogue(static_cast<std::size_t>(a_state.range(0)));
+		RunFrames(a_state, [&] { dialogue.Draw(); });
+	}
+
+	// the table path the row widget replaced, compare vertices and time against the Log benchmarks of the same size
+	void BM_DrawMonologueTable(benchmark::State& a_state)
+	{
+		MonologueTableView view{ MakeMonologues(static_cast<std::size_t>(a_state.range(0))) };
+		RunFrames(a_state, [&] { view.Draw(); });
+	}
+
+	void BM_DrawDialogueTable(benchmark::State& a_state)
+	{
+		DialogueTableView view{ MakeDialogue(static_cast<std::size_t>(a_state.range(0))) };
+		RunFrames(a_state, [&] { view.Draw(); });
+	}
+
+	// DialogueHistory::DrawTreeImpl over the date map, with every day expanded or collapsed
+	void BM_DrawDialogueTree(benchmark::State& a_state)
+	{
+		DialogueHistory history;
+		for (const auto& dialogue : Stubs::MakeHistory<Dialogue>(static_cast<std::size_t>(a_state.range(0)))) {
+			history.SaveHistory(dialogue.ExtractTimeStamp(), dialogue, false);
+		}
+
+		const bool open = a_state.range(1) != 0;
+		RunFrames(a_state, [&] {
+			MANAGER(GlobalHistory)->SetMenuOpenJustNow(open);
+			history.DrawTree(false);
+		});
+	}
+
+	// ConversationHistory::DrawTreeImpl over the location map
+	void BM_DrawConversationTree(benchmark::State& a_state)
+	{
+		ConversationHistory history;
+		history.history = MakeMonologues(static_cast<std::size_t>(a_state.range(0)));
+		history.RefreshHistoryMaps();
+
+		const bool open = a_state.range(1) != 0;
+		RunFrames(a_state, [&] {
+			MANAGER(GlobalHistory)->SetMenuOpenJustNow(open);
+			history.DrawTree(true);
+		});
+	}
+}
+
+BENCHMARK(BM_DrawMonologueLog)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DrawDialogueLog)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DrawMonologueTable)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DrawDialogueTable)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DrawDialogueTree)->ArgsProduct({ { 1000, 10000, 100000 }, { 0, 1 } })->ArgNames({ "entries", "open" })->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DrawConversationTree)->ArgsProduct({ { 1000, 10000, 100000 }, { 0, 1 } })->ArgNames({ "entries", "open" })->Unit(benchmark::kMillisecond);
@@ -0,0 +1,77 @@
+#include "AllocationCounter.h"
+#include "HistoryViews.h"
+#include "ImGuiHarness.h"
+
+#include <gtest/gtest.h>
+
+// once warmed up, a frame of the history views makes no heap allocations. Counted across ImGui and the draw code
+namespace
+{
+	using namespace GlobalHistory;
+	using namespace HistoryViews;
+
+	constexpr int warmupFrames = 5;
+	constexpr int frames = 300;
+
+	template <class F>
+	void ExpectNoAllocations(F&& a_draw)
+	{
+		ASSERT_TRUE(LoadTranslations());
+
+		ImGuiHarness::NullBackend backend;
+		backend.SetMousePos({ 960.0f, 200.0f });  // over the first rows, so the hover paths run
+
+		MANAGER(GlobalHistory)->SetGlobalHistoryOpen(true);
+
+		const auto draw = [&] { DrawWindow(a_draw); };
+		for (int i = 0; i < warmupFrames; i++) {
+			backend.Frame(draw);
+		}
+
+		std::size_t allocations = 0;
+		for (int i = 0; i < frames; i++) {
+			allocations += backend.Frame(draw).allocations;
+		}
+
+		MANAGER(GlobalHistory)->SetGlobalHistoryOpen(false);
+
+		EXPECT_EQ(allocations, 0u) << "over " << frames << " frames";
+	}
+}
+
+TEST(HistoryView, MonologueLogDoesNotAllocate)
+{
+	auto history = MakeMonologues(1000);
+	ExpectNoAllocations([&] { history.Draw(); });
+}
+
+TEST(HistoryView, DialogueLogDoesNotAllocate)
+{
+	auto dialogue = MakeDialogue(1000);
+	ExpectNoAllocations([&] { dialogue.Draw(); });
+}
+
+TEST(HistoryView, DialogueTreeDoesNotAllocate)
+{
+	DialogueHistory history;
+	for (const auto& dialogue : Stubs::MakeHistory<Dialogue>(1000)) {
+		history.SaveHistory(dialogue.ExtractTimeStamp(), dialogue, false);
+	}
+
+	ExpectNoAllocations([&] {
+		MANAGER(GlobalHistory)->SetMenuOpenJustNow(true);
+		history.DrawTree(false);
+	});
+}
+
+TEST(HistoryView, ConversationTreeDoesNotAllocate)
+{
+	ConversationHistory history;
+	history.history = MakeMonologues(1000);
+	history.RefreshHistoryMaps();
+
+	ExpectNoAllocations([&] {
+		MANAGER(GlobalHistory)->SetMenuOpenJustNow(true);
+		history.DrawTree(true);
+	});
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "GlobalHistory.h"
+#include "HistoryStubs.h"
+
+// generated histories and the window nesting of GlobalHistory::Manager::Draw, for the engine backed tests and benchmarks
+namespace HistoryViews
+{
+	inline bool LoadTranslations()
+	{
+		static const bool loaded = Translation::Manager::GetSingleton()->LoadTranslation(TRANSLATIONS_DIR "/DialogueHistory_ENGLISH.txt");
+		return loaded;
+	}
+
+	inline Monologues MakeMonologues(std::size_t a_count)
+	{
+		Monologues monologues;
+		monologues.monologues = Stubs::MakeHistory<Monologue>(a_count);
+		return monologues;
+	}
+
+	inline Dialogue MakeDialogue(std::size_t a_lines)
+	{
+		auto dialogue = Stubs::MakeHistory<Dialogue>(1).front();
+
+		const auto lines = dialogue.dialogue;
+		dialogue.dialogue.clear();
+		for (std::size_t i = 0; i < a_lines; i++) {
+			dialogue.dialogue.push_back(lines[i % lines.size()]);
+		}
+		return dialogue;
+	}
+
+	// a_draw in the history pane
+	template <class F>
+	void DrawWindow(F&& a_draw)
+	{
+		ImGui::SetNextWindowPos(ImGui::GetNativeViewportPos());
+		ImGui::SetNextWindowSize(ImGui::GetNativeViewportSize());
+		ImGui::Begin("##Main", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoBackground | ImGuiWindowFlags_NoSavedSettings);
+		{
+			auto [font, fontSize] = MANAGER(IconFont)->GetGlobalHistoryFont();
+			ImGui::PushFont(font, fontSize);
+			{
+				ImGui::SetNextWindowPos(ImGui::GetNativeViewportCenter(), ImGuiCond_Always, ImVec2(0.5f, 0.5f));
+				ImGui::BeginChild("##GlobalHistory", ImGui::GetNativeViewportSize() * 0.8f, ImGuiChildFlags_Border, ImGuiWindowFlags_NoScrollbar);
+				{
+					ImGui::BeginChild("##History", ImVec2(0.0f, 0.0f), ImGuiChildFlags_None, ImGuiWindowFlags_NoBackground);
+					{
+						a_draw();
+					}
+					ImGui::EndChild();
+				}
+				ImGui::EndChild();
+			}
+			ImGui::PopFont();
+		}
+		ImGui::End();
+	}
+}
@@ -0,0 +1,145 @@
+#include "ImGuiHarness.h"
+
+#include "AllocationCounter.h"
+
+namespace ImGuiHarness
+{
+	// through operator new, so AllocationCounter sees ImGui's allocations with everyone else's
+	static void* CountedAlloc(std::size_t a_size, void*)
+	{
+		return ::operator new(a_size);
+	}
+
+	static void CountedFree(void* a_ptr, void*)
+	{
+		::operator delete(a_ptr);
+	}
+
+	NullBackend::NullBackend(ImVec2 a_displaySize)
+	{
+		ImGui::SetAllocatorFunctions(CountedAlloc, CountedFree);
+
+		context = ImGui::CreateContext();
+
+		auto& io = ImGui::GetIO();
+		io.IniFilename = nullptr;
+		io.LogFilename = nullptr;
+		io.DisplaySize = a_displaySize;
+		io.DeltaTime = 1.0f / 60.0f;
+		io.BackendPlatformName = "null";
+		io.BackendRendererName = "null";
+#ifdef IMGUI_HAS_TEXTURES
+		io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+#endif
+
+		Stubs::ApplyStyle();
+		io.FontDefault = Stubs::GetFont();
+
+#ifndef IMGUI_HAS_TEXTURES
+		unsigned char* pixels = nullptr;
+		int            width = 0;
+		int            height = 0;
+		io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+		io.Fonts->SetTexID((ImTextureID)(std::intptr_t)1);
+#endif
+	}
+
+	NullBackend::~NullBackend()
+	{
+		UpdateTextures(true);
+
+		auto& io = ImGui::GetIO();
+		io.BackendPlatformName = nullptr;
+		io.BackendRendererName = nullptr;
+#ifdef IMGUI_HAS_TEXTURES
+		io.BackendFlags &= ~ImGuiBackendFlags_RendererHasTextures;
+#endif
+
+		ImGui::DestroyContext(context);
+	}
+
+	void NullBackend::SetMousePos(ImVec2 a_pos)
+	{
+		ImGui::GetIO().AddMousePosEvent(a_pos.x, a_pos.y);
+	}
+
+	std::size_t NullBackend::GetAllocationCount()
+	{
+		return AllocationCounter::Get();
+	}
+
+	void NullBackend::BeginFrame()
+	{
+		ImGui::NewFrame();
+	}
+
+	FrameStats NullBackend::EndFrame()
+	{
+		ImGui::Render();
+		UpdateTextures(false);
+
+		FrameStats stats{};
+
+		const auto drawData = ImGui::GetDrawData();
+		stats.vertices = drawData->TotalVtxCount;
+		stats.indices = drawData->TotalIdxCount;
+		for (const auto drawList : drawData->CmdLists) {
+			stats.drawCalls += drawList->CmdBuffer.Size;
+		}
+		return stats;
+	}
+
+	// what a renderer backend does with ImGui's texture requests, minus the GPU
+	void NullBackend::UpdateTextures([[maybe_unused]] bool a_destroyAll)
+	{
+#ifdef IMGUI_HAS_TEXTURES
+		ImTextureID nextID = 1;
+		for (const auto texture : ImGui::GetPlatformIO().Textures) {
+			if (a_destroyAll || texture->Status == ImTextureStatus_WantDestroy) {
+				texture->SetTexID(ImTextureID_Invalid);
+				texture->SetStatus(ImTextureStatus_Destroyed);
+			} else if (texture->Status == ImTextureStatus_WantCreate) {
+				texture->SetTexID(nextID++);
+				texture->SetStatus(ImTextureStatus_OK);
+			} else if (texture->Status == ImTextureStatus_WantUpdates) {
+				texture->SetStatus(ImTextureStatus_OK);
+			}
+		}
+#endif
+	}
+
+	namespace Stubs
+	{
+		void ApplyStyle()
+		{
+			auto& style = ImGui::GetStyle();
+
+			style.WindowBorderSize = 3.0f;
+			style.IndentSpacing = 8.0f;
+			style.FrameBorderSize = 1.5f;
+			style.Colors[ImGuiCol_WindowBg] = { 0.0f, 0.0f, 0.0f, 0.68f };
+			style.Colors[ImGuiCol_Border] = { 0.569f, 0.545f, 0.506f, 0.68f };
+			style.Colors[ImGuiCol_Header] = { 1.0f, 1.0f, 1.0f, 0.15f };
+			style.Colors[ImGuiCol_HeaderHovered] = { 1.0f, 1.0f, 1.0f, 0.1f };
+		}
+
+		ImFont* GetFont()
+		{
+			auto& io = ImGui::GetIO();
+			if (io.Fonts->Fonts.empty()) {
+				io.Fonts->AddFontDefault();
+			}
+			return io.Fonts->Fonts[0];
+		}
+
+		float GetFontSize()
+		{
+			return 24.0f;
+		}
+
+		float GetHeaderFontSize()
+		{
+			return 32.0f;
+		}
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <imgui.h>
+
+// ImGui without a renderer or platform backend, for benchmarking draw code off the game.
+// Textures are marked uploaded and draw data is only counted
+namespace ImGuiHarness
+{
+	struct FrameStats
+	{
+		int         vertices{ 0 };
+		int         indices{ 0 };
+		int         drawCalls{ 0 };
+		std::size_t allocations{ 0 };  // heap allocations made during the frame, ImGui's and the draw code's
+	};
+
+	class NullBackend
+	{
+	public:
+		explicit NullBackend(ImVec2 a_displaySize = { 1920.0f, 1080.0f });
+		~NullBackend();
+
+		NullBackend(const NullBackend&) = delete;
+		NullBackend& operator=(const NullBackend&) = delete;
+
+		// NewFrame, a_draw, Render
+		template <class F>
+		FrameStats Frame(F&& a_draw)
+		{
+			const auto allocations = GetAllocationCount();
+
+			BeginFrame();
+			a_draw();
+			auto stats = EndFrame();
+
+			stats.allocations = GetAllocationCount() - allocations;
+			return stats;
+		}
+
+		void SetMousePos(ImVec2 a_pos);
+
+		static std::size_t GetAllocationCount();
+
+	private:
+		void       BeginFrame();
+		FrameStats EndFrame();
+		void       UpdateTextures(bool a_destroyAll);
+
+		// members
+		ImGuiContext* context{ nullptr };
+	};
+
+	// the plugin's style and fonts, reduced to their defaults
+	namespace Stubs
+	{
+		void ApplyStyle();  // Styles::ApplyStyle with default values
+
+		ImFont* GetFont();  // stands in for the game font, ImGui's default font
+		float   GetFontSize();
+		float   GetHeaderFontSize();
+	}
+}
@@ -0,0 +1,96 @@
+#include "ImGui/ImageDecoder.h"
+#include "ImGui/ShelfPacker.h"
+#include "PNGDecoder.h"
+
+#include <benchmark/benchmark.h>
+
+// LoadIcons without the upload: decoding the requested icons, then placing them in the atlas
+namespace
+{
+	// icon sized PNGs in a few shapes, written once per run
+	const std::vector<std::filesystem::path>& GetIconFiles()
+	{
+		static const auto files = [] {
+			const auto dir = std::filesystem::temp_directory_path() / "DialogueHistoryImageBenchmarks";
+			std::filesystem::create_directories(dir);
+
+			std::mt19937                                 rng(1);
+			std::uniform_int_distribution<std::uint32_t> size(32, 128);
+			std::uniform_int_distribution<int>           value(0, 255);
+
+			std::vector<std::filesystem::path> paths;
+			for (std::uint32_t i = 0; i < 150; i++) {
+				const auto          w = size(rng);
+				const auto          h = i % 3 == 0 ? w : size(rng);
+				ImGui::DecodedImage image{ w, h, std::vector<std::uint8_t>(static_cast<std::size_t>(w) * h * 4) };
+				for (auto& pixel : image.pixels) {
+					pixel = static_cast<std::uint8_t>(value(rng) & 0xF0);  // some redundancy for deflate, like real icons
+				}
+
+				auto& path = paths.emplace_back(dir / ("icon" + std::to_string(i) + ".png"));
+				PNGDecoder::Write(path, image);
+			}
+			return paths;
+		}();
+		return files;
+	}
+
+	void BM_DecodeIconsParallel(benchmark::State& a_state)
+	{
+		const auto& paths = GetIconFiles();
+
+		PNGDecoder decoder;
+		for (auto _ : a_state) {
+			std::vector<ImGui::DecodedImage> images(paths.size());
+			benchmark::DoNotOptimize(ImGui::DecodeParallel(decoder, paths, images));
+		}
+		a_state.SetItemsProcessed(a_state.iterations() * static_cast<std::int64_t>(paths.size()));
+	}
+
+	// the one at a time loop DecodeParallel replaced
+	void BM_DecodeIconsSerial(benchmark::State& a_state)
+	{
+		const auto& paths = GetIconFiles();
+
+		PNGDecoder decoder;
+		for (auto _ : a_state) {
+			std::vector<ImGui::DecodedImage> images(paths.size());
+			for (std::size_t i = 0; i < paths.size(); i++) {
+				benchmark::DoNotOptimize(decoder.Decode(paths[i], images[i]));
+			}
+		}
+		a_state.SetItemsProcessed(a_state.iterations() * static_cast<std::int64_t>(paths.size()));
+	}
+
+	void BM_PackIcons(benchmark::State& a_state)
+	{
+		std::mt19937                                 rng(1);
+		std::uniform_int_distribution<std::uint32_t> size(32, 128);
+
+		std::vector<ImGui::ShelfPacker::Size> sizes(static_cast<std::size_t>(a_state.range(0)));
+		for (auto& [w, h] : sizes) {
+			w = size(rng);
+			h = size(rng);
+		}
+
+		std::uint64_t used = 0;
+		for (const auto& [w, h] : sizes) {
+			used += static_cast<std::uint64_t>(w) * h;
+		}
+
+		ImGui::ShelfPacker packer(16384);
+		for (auto _ : a_state) {
+			packer.Clear();
+			benchmark::DoNotOptimize(packer.InsertBatch(sizes));
+		}
+
+		a_state.counters["atlasWidth"] = packer.GetWidth();
+		a_state.counters["atlasHeight"] = packer.GetHeight();
+		a_state.counters["occupancy"] = static_cast<double>(used) / (static_cast<double>(packer.GetWidth()) * packer.GetHeight());
+		a_state.SetItemsProcessed(a_state.iterations() * a_state.range(0));
+	}
+}
+
+BENCHMARK(BM_DecodeIconsParallel)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_DecodeIconsSerial)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_PackIcons)->RangeMultiplier(10)->Range(150, 15000);
@@ -0,0 +1,87 @@
+#include "ImGui/ImageDecoder.h"
+#include "PNGDecoder.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+	std::filesystem::path TempDir()
+	{
+		auto dir = std::filesystem::temp_directory_path() / "DialogueHistoryImageTests";
+		std::filesystem::create_directories(dir);
+		return dir;
+	}
+
+	// every pixel differs, so rows or channels in the wrong place are caught
+	ImGui::DecodedImage MakeGradient(std::uint32_t a_width, std::uint32_t a_height)
+	{
+		ImGui::DecodedImage image{ a_width, a_height, std::vector<std::uint8_t>(static_cast<std::size_t>(a_width) * a_height * 4) };
+		for (std::size_t i = 0; i < image.pixels.size(); i++) {
+			image.pixels[i] = static_cast<std::uint8_t>(i * 7 + i / 4);
+		}
+		return image;
+	}
+}
+
+TEST(ImageDecoder, DecodesInParallel)
+{
+	const auto dir = TempDir();
+
+	std::vector<ImGui::DecodedImage>   expected;
+	std::vector<std::filesystem::path> paths;
+	for (std::uint32_t i = 0; i < 24; i++) {
+		auto& image = expected.emplace_back(MakeGradient(8 + i * 3, 40 - i));
+		auto& path = paths.emplace_back(dir / ("icon" + std::to_string(i) + ".png"));
+		ASSERT_TRUE(PNGDecoder::Write(path, image));
+	}
+
+	PNGDecoder                       decoder;
+	std::vector<ImGui::DecodedImage> decoded(paths.size());
+	const auto                       results = ImGui::DecodeParallel(decoder, paths, decoded);
+
+	for (std::size_t i = 0; i < paths.size(); i++) {
+		EXPECT_EQ(results[i], PNGDecoder::kNone);
+		EXPECT_EQ(decoded[i].width, expected[i].width);
+		EXPECT_EQ(decoded[i].height, expected[i].height);
+		EXPECT_EQ(decoded[i].pixels, expected[i].pixels) << paths[i];
+	}
+}
+
+TEST(ImageDecoder, ReportsFailuresPerFile)
+{
+	const auto dir = TempDir();
+
+	const auto valid = dir / "valid.png";
+	const auto corrupt = dir / "corrupt.png";
+	ASSERT_TRUE(PNGDecoder::Write(valid, MakeGradient(4, 4)));
+	std::ofstream(corrupt, std::ios::binary) << "not a png";
+
+	const std::vector<std::filesystem::path> paths{ valid, dir / "missing.png", corrupt };
+
+	PNGDecoder                       decoder;
+	std::vector<ImGui::DecodedImage> decoded(paths.size());
+	const auto                       results = ImGui::DecodeParallel(decoder, paths, decoded);
+
+	EXPECT_EQ(results[0], PNGDecoder::kNone);
+	EXPECT_NE(results[1], PNGDecoder::kNone);
+	EXPECT_NE(results[2], PNGDecoder::kNone);
+	EXPECT_FALSE(decoded[0].empty());
+	EXPECT_TRUE(decoded[1].empty());
+	EXPECT_TRUE(decoded[2].empty());
+}
+
+TEST(ImageDecoder, PlaceholderIsOpaque)
+{
+	const auto placeholder = ImGui::MakePlaceholder(32);
+
+	ASSERT_EQ(placeholder.width, 32u);
+	ASSERT_EQ(placeholder.height, 32u);
+	ASSERT_EQ(placeholder.pixels.size(), 32u * 32u * 4u);
+
+	std::set<std::uint32_t> colors;
+	for (std::size_t i = 0; i < placeholder.pixels.size(); i += 4) {
+		EXPECT_EQ(placeholder.pixels[i + 3], 255);
+		colors.insert(placeholder.pixels[i] << 16 | placeholder.pixels[i + 1] << 8 | placeholder.pixels[i + 2]);
+	}
+	EXPECT_EQ(colors, (std::set<std::uint32_t>{ 0x000000, 0xFF00FF }));
+}
@@ -0,0 +1,67 @@
+#include "InputReplay.h"
+
+#include "GlobalHistory.h"
+#include "Hotkeys.h"
+#include "ImGui/Renderer.h"
+#include "InputRecorder.h"
+
+namespace InputReplay
+{
+	void LoadSettings(bool a_recordInput, bool a_replayInput)
+	{
+		CSimpleIniA ini;
+		ini.SetBoolValue("Settings", "bRecordInput", a_recordInput);
+		ini.SetBoolValue("Settings", "bReplayInput", a_replayInput);
+		ini.SetLongValue("Controls", "iGlobalHistoryKey", globalHistoryKey);
+
+		MANAGER(InputRecorder)->LoadMCMSettings(ini);
+		MANAGER(Hotkeys)->LoadHotKeys(ini);
+	}
+
+	Driver::Driver()
+	{
+		// as ImGui::Renderer::Install leaves them
+		ImGui::GetIO().ConfigFlags = ImGuiConfigFlags_NavEnableKeyboard | ImGuiConfigFlags_NavEnableGamepad | ImGuiConfigFlags_NoMouseCursorChange;
+
+		// the recorder only keeps frames where the menus are drawn
+		ImGui::Renderer::renderMenus = true;
+	}
+
+	Driver::~Driver()
+	{
+		if (MANAGER(GlobalHistory)->IsGlobalHistoryOpen()) {
+			MANAGER(GlobalHistory)->SetGlobalHistoryOpen(false);
+		}
+		MANAGER(Hotkeys)->ResetKeyState();
+
+		ImGui::Renderer::renderMenus = false;
+	}
+
+	FrameState Driver::Frame(std::span<const Input::Event> a_events)
+	{
+		// Input::Manager::ProcessInputEvents, then the rest of Hooks::ProcessInputQueue
+		MANAGER(Input)->ProcessEvents(MANAGER(InputRecorder)->Process(a_events));
+		MANAGER(Hotkeys)->TryToggleDialogueHistory();
+
+		backend.Frame([this] { Draw(); });
+
+		return { MANAGER(GlobalHistory)->IsGlobalHistoryOpen(), ImGui::GetIO().WantTextInput, nameFilter.data() };
+	}
+
+	// the name filter of the global history, focused when the window opens
+	void Driver::Draw()
+	{
+		if (!MANAGER(GlobalHistory)->IsGlobalHistoryOpen()) {
+			return;
+		}
+
+		ImGui::Begin("##GlobalHistory", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoSavedSettings);
+		{
+			if (ImGui::IsWindowAppearing()) {
+				ImGui::SetKeyboardFocusHere();
+			}
+			ImGui::InputText("##Name", nameFilter.data(), nameFilter.size());
+		}
+		ImGui::End();
+	}
+}
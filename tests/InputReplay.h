@@ -0,0 +1,44 @@
+#pragma once
+
+#include "ImGuiHarness.h"
+#include "Input.h"
+
+// Hooks::ProcessInputQueue and a history window, off the game. Each frame's batch goes through InputRecorder, Input and
+// Hotkeys before the window is drawn on the null backend, so a recording plays back the way it would in game
+namespace InputReplay
+{
+	inline constexpr std::uint32_t globalHistoryKey = KEY::kJ;  // iGlobalHistoryKey, on press
+
+	// what a frame left behind, compared between a session and its replay
+	struct FrameState
+	{
+		bool operator==(const FrameState&) const = default;
+
+		// members
+		bool        globalHistoryOpen{ false };
+		bool        typing{ false };
+		std::string nameFilter{};
+	};
+
+	// the MCM settings the driver runs with, through the same LoadMCMSettings and LoadHotKeys as the plugin
+	void LoadSettings(bool a_recordInput, bool a_replayInput);
+
+	class Driver
+	{
+	public:
+		Driver();
+		~Driver();
+
+		Driver(const Driver&) = delete;
+		Driver& operator=(const Driver&) = delete;
+
+		FrameState Frame(std::span<const Input::Event> a_events);  // live input, replaced by the recording while one plays
+
+	private:
+		void Draw();
+
+		// members
+		ImGuiHarness::NullBackend backend;
+		std::array<char, 64>      nameFilter{};
+	};
+}
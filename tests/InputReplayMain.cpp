@@ -0,0 +1,57 @@
+#include "InputRecorder.h"
+#include "InputReplay.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+// plays an input recording off the game, printing each frame that changed the menu
+//
+//   input_replay [DialogueHistory_Input.bin]
+//
+// without an argument, the recording the engine tests left in the stand-in log directory is used
+int main(int a_argc, char* a_argv[])
+{
+	const auto path = InputRecorder::Manager::GetFilePath();
+	if (!path) {
+		std::fprintf(stderr, "no log directory\n");
+		return EXIT_FAILURE;
+	}
+
+	if (a_argc > 1) {
+		std::error_code ec;
+		if (!std::filesystem::equivalent(a_argv[1], *path, ec)) {
+			std::filesystem::copy_file(a_argv[1], *path, std::filesystem::copy_options::overwrite_existing, ec);
+		}
+		if (ec) {
+			std::fprintf(stderr, "unable to copy %s to %s\n", a_argv[1], path->string().c_str());
+			return EXIT_FAILURE;
+		}
+	}
+
+	InputReplay::LoadSettings(false, true);
+
+	std::size_t frames = 0;
+	{
+		InputReplay::Driver     driver;
+		InputReplay::FrameState last{};
+
+		do {
+			const auto state = driver.Frame({});
+			if (state != last) {
+				std::printf("%6zu  %-6s  %-6s  \"%s\"\n", frames, state.globalHistoryOpen ? "open" : "closed", state.typing ? "typing" : "", state.nameFilter.c_str());
+				last = state;
+			}
+			frames++;
+		} while (MANAGER(InputRecorder)->IsReplaying());
+	}
+
+	InputReplay::LoadSettings(false, false);
+
+	if (frames <= 1) {
+		std::fprintf(stderr, "%s is not an input recording\n", path->string().c_str());
+		return EXIT_FAILURE;
+	}
+
+	std::printf("%zu frames replayed\n", frames - 1);
+	return EXIT_SUCCESS;
+}
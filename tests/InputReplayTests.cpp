@@ -0,0 +1,118 @@
+#include "InputRecorder.h"
+#include "InputReplay.h"
+
+#include <gtest/gtest.h>
+
+// a session recorded through InputRecorder replays frame for frame, and a damaged recording falls back to live input
+namespace
+{
+	using Input::Event;
+
+	Event Key(std::uint32_t a_key, bool a_down)
+	{
+		return { .type = Event::TYPE::kButton, .device = RE::INPUT_DEVICE::kKeyboard, .idCode = a_key, .value = a_down ? 1.0f : 0.0f, .heldDownSecs = a_down ? 0.0f : 0.1f };
+	}
+
+	Event Char(char a_char)
+	{
+		return { .type = Event::TYPE::kChar, .device = RE::INPUT_DEVICE::kKeyboard, .idCode = static_cast<std::uint8_t>(a_char) };
+	}
+
+	// open global history, type a name, try to close it while typing, confirm the name, close it
+	std::vector<std::vector<Event>> MakeSession()
+	{
+		std::vector<std::vector<Event>> frames;
+
+		const auto press = [&](std::uint32_t a_key) {
+			frames.push_back({ Key(a_key, true) });
+			frames.push_back({ Key(a_key, false) });
+			frames.insert(frames.end(), 2, std::vector<Event>{});  // focus and text input settle a frame late
+		};
+
+		press(InputReplay::globalHistoryKey);
+		for (const auto c : "guard"sv) {
+			frames.push_back({ Char(c) });
+		}
+		press(InputReplay::globalHistoryKey);
+		press(KEY::kEnter);
+		press(InputReplay::globalHistoryKey);
+
+		return frames;
+	}
+
+	// frames until the recording is closed
+	std::vector<InputReplay::FrameState> RunSession(const std::vector<std::vector<Event>>& a_session, bool a_recordInput, bool a_replayInput)
+	{
+		std::vector<InputReplay::FrameState> states;
+
+		InputReplay::LoadSettings(a_recordInput, a_replayInput);
+		{
+			InputReplay::Driver driver;
+			for (const auto& batch : a_session) {
+				states.push_back(driver.Frame(a_replayInput ? std::span<const Event>{} : batch));
+			}
+
+			InputReplay::LoadSettings(false, false);
+			driver.Frame({});
+		}
+
+		return states;
+	}
+}
+
+TEST(InputReplay, ReplaysRecordedSession)
+{
+	const auto session = MakeSession();
+
+	const auto recorded = RunSession(session, true, false);
+	const auto replayed = RunSession(session, false, true);
+
+	ASSERT_EQ(replayed.size(), recorded.size());
+	for (std::size_t i = 0; i < recorded.size(); i++) {
+		EXPECT_EQ(replayed[i], recorded[i]) << "frame " << i;
+	}
+
+	// three presses, the one made while typing is ignored
+	const auto toggles = std::ranges::count_if(std::views::iota(std::size_t{ 1 }, recorded.size()), [&](std::size_t i) {
+		return recorded[i].globalHistoryOpen != recorded[i - 1].globalHistoryOpen;
+	});
+	EXPECT_TRUE(recorded.front().globalHistoryOpen);
+	EXPECT_EQ(toggles, 1);
+	EXPECT_TRUE(std::ranges::any_of(recorded, &InputReplay::FrameState::typing));
+
+	EXPECT_FALSE(recorded.back().globalHistoryOpen);
+	EXPECT_EQ(recorded.back().nameFilter, "guard");
+	EXPECT_EQ(MANAGER(Input)->GetInputDevice(), Input::DEVICE::kKeyboard);
+}
+
+TEST(InputReplay, DropsBatchLargerThanTheFile)
+{
+	const auto path = InputRecorder::Manager::GetFilePath();
+	ASSERT_TRUE(path);
+
+	RunSession({ { Key(KEY::kDown, true) } }, true, false);
+
+	// a count no file this size can hold, as a crash mid write leaves it
+	{
+		std::ofstream file(*path, std::ios::binary | std::ios::app);
+
+		const std::uint32_t count = 0x40000000;
+		file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+	}
+
+	const std::vector<Event> live{ Key(KEY::kUp, true) };
+
+	InputReplay::LoadSettings(false, true);
+	const auto recorder = MANAGER(InputRecorder);
+
+	const auto first = recorder->Process(live);
+	ASSERT_EQ(first.size(), 1u);
+	EXPECT_EQ(first.front().idCode, KEY::kDown);
+	EXPECT_TRUE(recorder->IsReplaying());
+
+	EXPECT_EQ(recorder->Process(live).data(), live.data());
+	EXPECT_FALSE(recorder->IsReplaying());
+
+	InputReplay::LoadSettings(false, false);
+	recorder->Process(live);
+}
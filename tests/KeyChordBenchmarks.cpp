@@ -0,0 +1,117 @@
+#include "KeyChord.h"
+
+#include <benchmark/benchmark.h>
+
+// Hotkeys::Manager's per frame work over a synthetic input stream: button events update the key state, both
+// combos are evaluated and the wheel keys released. The set baseline is the matcher the bitset chords replaced
+namespace
+{
+	using namespace Hotkeys;
+
+	struct KeyEvent
+	{
+		std::uint32_t key;
+		bool          pressed;
+	};
+
+	// a_perFrame button events per frame: mostly movement keys and mouse buttons, a scroll now and then, and the
+	// shift + ctrl chord pressed and released every few dozen frames
+	std::vector<std::vector<KeyEvent>> MakeEventStream(std::size_t a_frames, std::size_t a_perFrame)
+	{
+		std::mt19937                                 rng(1);
+		std::uniform_int_distribution<std::uint32_t> noise(0, 9);
+
+		constexpr std::array<std::uint32_t, 8> keys{ 0x11, 0x1E, 0x1F, 0x20, 0x39, 256, 257, wheelUpKey };
+
+		std::array<bool, keys.size()> down{};
+
+		std::vector<std::vector<KeyEvent>> frames(a_frames);
+		for (std::size_t frame = 0; frame < a_frames; frame++) {
+			auto& events = frames[frame];
+			for (std::size_t i = 0; i < a_perFrame; i++) {
+				const auto idx = noise(rng) % keys.size();
+				down[idx] = keys[idx] == wheelUpKey || !down[idx];
+				events.push_back({ keys[idx], down[idx] });
+			}
+			if (frame % 40 == 0) {
+				events.push_back({ 0x2A, true });
+				events.push_back({ 0x1D, true });
+			} else if (frame % 40 == 20) {
+				events.push_back({ 0x2A, false });
+				events.push_back({ 0x1D, false });
+			}
+		}
+		return frames;
+	}
+
+	std::array<Chord, 4> MakeChords()
+	{
+		std::array<Chord, 4> chords{};
+		chords[0].values = { 0x2A, 0x1D };        // local history, keyboard
+		chords[1].values = { 266 + 4, 266 + 5 };  // local history, gamepad
+		chords[2].values = { 0x2A, 0x1D, 0x10 };  // global history, keyboard
+		chords[3].values = { 266 + 6 };           // global history, gamepad
+		for (auto& chord : chords) {
+			chord.UpdateKeys();
+		}
+		return chords;
+	}
+
+	void BM_ChordEventStream(benchmark::State& a_state)
+	{
+		const auto stream = MakeEventStream(1024, static_cast<std::size_t>(a_state.range(0)));
+		const auto chords = MakeChords();
+
+		std::array<Trigger, 2> triggers{};
+		triggers[1].type = TRIGGER::kHold;
+
+		KeyState                   state{};
+		Trigger::clock::time_point now{};
+		std::size_t                frame = 0;
+		std::int64_t               activations = 0;
+
+		for (auto _ : a_state) {
+			for (const auto& [key, pressed] : stream[frame++ % stream.size()]) {
+				state.set(key, pressed);
+			}
+
+			now += 16ms;
+			activations += triggers[0].Update(chords[0].Matches(state) || chords[1].Matches(state), now, 0.5f, 0.3f);
+			activations += triggers[1].Update(chords[2].Matches(state) || chords[3].Matches(state), now, 0.5f, 0.3f);
+
+			ReleaseWheelKeys(state);
+		}
+
+		benchmark::DoNotOptimize(activations);
+		a_state.SetItemsProcessed(a_state.iterations());
+	}
+
+	// the removed KeyCombo::ProcessKeyPress, the pressed keys of the batch collected into a set and compared
+	void BM_SetEventStream(benchmark::State& a_state)
+	{
+		const auto stream = MakeEventStream(1024, static_cast<std::size_t>(a_state.range(0)));
+		const auto chords = MakeChords();
+
+		std::size_t  frame = 0;
+		std::int64_t activations = 0;
+
+		for (auto _ : a_state) {
+			std::set<std::uint32_t> pressed;
+			for (const auto& [key, isPressed] : stream[frame++ % stream.size()]) {
+				if (isPressed) {
+					pressed.insert(key);
+				}
+			}
+
+			for (const auto& chord : chords) {
+				activations += !pressed.empty() && pressed == chord.keys;
+			}
+		}
+
+		benchmark::DoNotOptimize(activations);
+		a_state.SetItemsProcessed(a_state.iterations());
+	}
+}
+
+BENCHMARK(BM_ChordEventStream)->RangeMultiplier(4)->Range(1, 64)->ArgName("events");
+BENCHMARK(BM_SetEventStream)->RangeMultiplier(4)->Range(1, 64)->ArgName("events");
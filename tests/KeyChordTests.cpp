@@ -0,0 +1,236 @@
+#include "AllocationCounter.h"
+#include "KeyChord.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+	using namespace Hotkeys;
+	using clock = Trigger::clock;
+
+	constexpr float holdTime = 0.5f;
+	constexpr float doubleTapTime = 0.3f;
+
+	Chord MakeChord(std::vector<std::int32_t> a_values)
+	{
+		Chord chord;
+		chord.values = std::move(a_values);
+		chord.UpdateKeys();
+		return chord;
+	}
+
+	KeyState MakeState(std::initializer_list<std::size_t> a_keys)
+	{
+		KeyState state;
+		for (const auto key : a_keys) {
+			state.set(key);
+		}
+		return state;
+	}
+
+	// steps a trigger through frames of a fixed length
+	struct Frames
+	{
+		explicit Frames(TRIGGER a_type)
+		{
+			trigger.type = a_type;
+		}
+
+		bool Step(bool a_down, std::chrono::milliseconds a_elapsed = 16ms)
+		{
+			now += a_elapsed;
+			return trigger.Update(a_down, now, holdTime, doubleTapTime);
+		}
+
+		// frames that activated while the chord was held or released for a_duration
+		int Run(bool a_down, std::chrono::milliseconds a_duration)
+		{
+			int activations = 0;
+			for (auto elapsed = 0ms; elapsed < a_duration; elapsed += 16ms) {
+				activations += Step(a_down);
+			}
+			return activations;
+		}
+
+		Trigger           trigger;
+		clock::time_point now{};
+	};
+}
+
+TEST(Chord, MatchesExactKeys)
+{
+	const auto chord = MakeChord({ 0x2A, 0x1D });  // shift + ctrl
+
+	EXPECT_TRUE(chord.Matches(MakeState({ 0x1D, 0x2A })));
+	EXPECT_FALSE(chord.Matches(MakeState({ 0x2A })));
+	EXPECT_FALSE(chord.Matches(MakeState({ 0x2A, 0x1D, 0x10 })));  // extra key held
+	EXPECT_FALSE(chord.Matches({}));
+}
+
+TEST(Chord, SkipsUnsetAndOutOfRangeValues)
+{
+	const auto chord = MakeChord({ 0x10, -1, 600, 0x11 });
+
+	EXPECT_EQ(chord.keys, (std::set<std::uint32_t>{ 0x10, 0x11 }));
+	EXPECT_TRUE(chord.Matches(MakeState({ 0x10, 0x11 })));
+}
+
+TEST(Chord, EmptyNeverMatches)
+{
+	const auto chord = MakeChord({ -1 });
+
+	EXPECT_TRUE(chord.keys.empty());
+	EXPECT_FALSE(chord.Matches({}));
+}
+
+TEST(Chord, UpdateKeysReplacesOldKeys)
+{
+	auto chord = MakeChord({ 0x10 });
+	chord.values = { 0x11 };
+	chord.UpdateKeys();
+
+	EXPECT_FALSE(chord.Matches(MakeState({ 0x10 })));
+	EXPECT_TRUE(chord.Matches(MakeState({ 0x11 })));
+}
+
+TEST(Chord, WheelKeysOnlyLastOneFrame)
+{
+	const auto wheelChord = MakeChord({ wheelUpKey, 0x2A });  // shift + wheel up
+	const auto shiftChord = MakeChord({ 0x2A });
+
+	Frames wheel(TRIGGER::kPress);
+	Frames shift(TRIGGER::kPress);
+
+	// one scroll while shift is held, no release ever arrives for the wheel
+	auto state = MakeState({ 0x2A, wheelUpKey });
+
+	EXPECT_TRUE(wheel.Step(wheelChord.Matches(state)));
+	EXPECT_FALSE(shift.Step(shiftChord.Matches(state)));
+	ReleaseWheelKeys(state);
+
+	EXPECT_EQ(state, MakeState({ 0x2A }));
+	EXPECT_FALSE(wheel.Step(wheelChord.Matches(state)));
+	EXPECT_TRUE(shift.Step(shiftChord.Matches(state)));
+
+	// scrolling again is a new press
+	state.set(wheelUpKey);
+	EXPECT_TRUE(wheel.Step(wheelChord.Matches(state)));
+	ReleaseWheelKeys(state);
+
+	state.set(wheelDownKey);
+	ReleaseWheelKeys(state);
+	EXPECT_EQ(state, MakeState({ 0x2A }));
+}
+
+TEST(Trigger, PressFiresOncePerPress)
+{
+	Frames frames(TRIGGER::kPress);
+
+	EXPECT_TRUE(frames.Step(true));
+	EXPECT_EQ(frames.Run(true, 1s), 0);
+	EXPECT_EQ(frames.Run(false, 100ms), 0);
+	EXPECT_TRUE(frames.Step(true));
+}
+
+TEST(Trigger, HoldFiresAfterHoldTime)
+{
+	Frames frames(TRIGGER::kHold);
+
+	EXPECT_FALSE(frames.Step(true));
+	EXPECT_FALSE(frames.Step(true, 400ms));
+	EXPECT_TRUE(frames.Step(true, 100ms));
+	EXPECT_EQ(frames.Run(true, 2s), 0);  // once per hold
+}
+
+// frames keep coming while the key is held without any new button events
+TEST(Trigger, HoldFiresFromFrameUpdatesAlone)
+{
+	Frames frames(TRIGGER::kHold);
+
+	EXPECT_EQ(frames.Run(true, 600ms), 1);
+}
+
+TEST(Trigger, HoldReleasedEarlyDoesNotFire)
+{
+	Frames frames(TRIGGER::kHold);
+
+	EXPECT_EQ(frames.Run(true, 400ms), 0);
+	EXPECT_EQ(frames.Run(false, 1s), 0);
+	EXPECT_EQ(frames.Run(true, 400ms), 0);  // timer restarts on the new press
+	EXPECT_EQ(frames.Run(true, 200ms), 1);
+}
+
+TEST(Trigger, DoubleTapWithinWindow)
+{
+	Frames frames(TRIGGER::kDoubleTap);
+
+	EXPECT_FALSE(frames.Step(true));
+	EXPECT_FALSE(frames.Step(false, 50ms));
+	EXPECT_TRUE(frames.Step(true, 100ms));
+}
+
+TEST(Trigger, DoubleTapTooSlow)
+{
+	Frames frames(TRIGGER::kDoubleTap);
+
+	EXPECT_FALSE(frames.Step(true));
+	EXPECT_FALSE(frames.Step(false, 50ms));
+	EXPECT_FALSE(frames.Step(true, 400ms));  // counts as a new first tap
+	EXPECT_FALSE(frames.Step(false, 50ms));
+	EXPECT_TRUE(frames.Step(true, 50ms));
+}
+
+TEST(Trigger, TripleTapFiresOnce)
+{
+	Frames frames(TRIGGER::kDoubleTap);
+
+	int activations = 0;
+	for (int i = 0; i < 3; i++) {
+		activations += frames.Step(true, 40ms);
+		activations += frames.Step(false, 40ms);
+	}
+	EXPECT_EQ(activations, 1);
+}
+
+TEST(Trigger, ResetForgetsPendingTap)
+{
+	Frames frames(TRIGGER::kDoubleTap);
+
+	frames.Step(true);
+	frames.Step(false);
+	frames.trigger.Reset();
+	EXPECT_FALSE(frames.Step(true));
+}
+
+TEST(Trigger, ResetWhileDownFiresPressAgain)
+{
+	Frames frames(TRIGGER::kPress);
+
+	EXPECT_TRUE(frames.Step(true));
+	frames.trigger.Reset();
+	EXPECT_TRUE(frames.Step(true));
+}
+
+// what Hotkeys::Manager::TryToggleDialogueHistory does each frame, for both combos and every trigger type
+TEST(KeyChord, FramesDoNotAllocate)
+{
+	const auto keyboard = MakeChord({ 0x2A, 0x1D });
+	const auto gamePad = MakeChord({ 266 + 4 });
+
+	std::array<Frames, 3> combos{ Frames(TRIGGER::kPress), Frames(TRIGGER::kHold), Frames(TRIGGER::kDoubleTap) };
+
+	const std::array states{ MakeState({}), MakeState({ 0x2A }), MakeState({ 0x1D, 0x2A }), MakeState({ 266 + 4 }) };
+
+	int activations = 0;
+
+	const AllocationCounter::Scope allocations;
+	for (int frame = 0; frame < 10000; frame++) {
+		const auto& state = states[frame / 7 % states.size()];
+		for (auto& combo : combos) {
+			activations += combo.Step(keyboard.Matches(state) || gamePad.Matches(state));
+		}
+	}
+	EXPECT_EQ(allocations.GetCount(), 0u);
+
+	EXPECT_GT(activations, 0);
+}
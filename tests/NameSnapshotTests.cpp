@@ -0,0 +1,79 @@
+#include "GlobalHistory.h"
+#include "NPCNameProvider.h"
+
+#include <gtest/gtest.h>
+
+// names saved with the history only cover actors the game resolves, and a form that disappears since the save drops
+// its own name instead of discarding the whole snapshot
+namespace
+{
+	using namespace GlobalHistory;
+
+	Dialogue MakeEntry(RE::FormID a_speaker, std::string a_speakerName, std::uint64_t a_timeStamp)
+	{
+		Dialogue dialogue{};
+		dialogue.timeStamp = a_timeStamp;
+		dialogue.id.SetNumericID(a_speaker);
+		dialogue.speakerName = std::move(a_speakerName);
+		return dialogue;
+	}
+}
+
+TEST(NameSnapshot, OnlySavesResolvedActors)
+{
+	RE::Actor lydia(0x000A2C94, "Lydia");
+
+	const std::vector history{ MakeEntry(0x000A2C94, "Lydia", 1), MakeEntry(0x000B0001, "Ghost", 2) };
+
+	const auto snapshot = NameSnapshot::Create(history);
+
+	EXPECT_EQ(snapshot.speakers, (std::map<RE::FormID, std::string>{ { 0x000A2C94, "Lydia" } }));
+}
+
+TEST(NameSnapshot, MissingFormDropsOnlyItsEntry)
+{
+	NPCNameProvider::GetSingleton()->ClearCache();
+
+	RE::Actor lydia(0x000A2C94, "Lydia");
+
+	auto snapshot = NameSnapshot::Create(std::vector{ MakeEntry(0x000A2C94, "Lydia", 1) });
+	snapshot.speakers.emplace(0x000B0001, "Ghost");  // an actor removed since the save
+	snapshot.topics.emplace(0x000C0001, 1);
+
+	snapshot.BeginRevalidation();
+	EXPECT_TRUE(snapshot.Revalidate(16));
+
+	EXPECT_FALSE(snapshot.stale);
+	EXPECT_EQ(snapshot.speakers, (std::map<RE::FormID, std::string>{ { 0x000A2C94, "Lydia" } }));
+	EXPECT_TRUE(snapshot.topics.empty());
+	EXPECT_EQ(snapshot.FindSpeaker(0x000A2C94), "Lydia");
+}
+
+TEST(NameSnapshot, RenamedActorMarksStale)
+{
+	NPCNameProvider::GetSingleton()->ClearCache();
+
+	RE::Actor lydia(0x000A2C94, "Lydia the Housecarl");
+
+	auto snapshot = NameSnapshot::Create(std::vector{ MakeEntry(0x000A2C94, "Lydia", 1) });
+
+	snapshot.BeginRevalidation();
+	EXPECT_TRUE(snapshot.Revalidate(16));
+	EXPECT_TRUE(snapshot.stale);
+}
+
+TEST(DialogueHistory, RefreshCurrentHistoryTakesResolvedNames)
+{
+	DialogueHistory history;
+	history.history = { MakeEntry(0x000A2C94, "Lydia", 1), MakeEntry(0x000A2C95, "Jordis", 2) };
+	history.SetCurrentHistory(history.history[1]);
+
+	history.history[1].speakerName = "Jordis the Sword-Maiden";
+	history.RefreshCurrentHistory();
+	ASSERT_TRUE(history.currentHistory);
+	EXPECT_EQ(history.currentHistory->speakerName, "Jordis the Sword-Maiden");
+
+	history.history.pop_back();
+	history.RefreshCurrentHistory();
+	EXPECT_FALSE(history.currentHistory);
+}
@@ -0,0 +1,38 @@
+#include "PNGDecoder.h"
+
+#include <png.h>
+
+std::int32_t PNGDecoder::Decode(const std::filesystem::path& a_path, ImGui::DecodedImage& a_image)
+{
+	png_image png{};
+	png.version = PNG_IMAGE_VERSION;
+
+	if (!png_image_begin_read_from_file(&png, a_path.string().c_str())) {
+		return kOpen;
+	}
+
+	png.format = PNG_FORMAT_RGBA;
+
+	a_image.width = png.width;
+	a_image.height = png.height;
+	a_image.pixels.resize(PNG_IMAGE_SIZE(png));
+
+	if (!png_image_finish_read(&png, nullptr, a_image.pixels.data(), 0, nullptr)) {
+		png_image_free(&png);
+		a_image = {};
+		return kDecode;
+	}
+
+	return kNone;
+}
+
+bool PNGDecoder::Write(const std::filesystem::path& a_path, const ImGui::DecodedImage& a_image)
+{
+	png_image png{};
+	png.version = PNG_IMAGE_VERSION;
+	png.width = a_image.width;
+	png.height = a_image.height;
+	png.format = PNG_FORMAT_RGBA;
+
+	return png_image_write_to_file(&png, a_path.string().c_str(), 0, a_image.pixels.data(), 0, nullptr) != 0;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "ImGui/ImageDecoder.h"
+
+// libpng in place of WIC, for decoding off Windows
+class PNGDecoder : public ImGui::IImageDecoder
+{
+public:
+	enum RESULT : std::int32_t
+	{
+		kNone = 0,
+		kOpen,
+		kDecode
+	};
+
+	std::int32_t Decode(const std::filesystem::path& a_path, ImGui::DecodedImage& a_image) override;
+
+	static bool Write(const std::filesystem::path& a_path, const ImGui::DecodedImage& a_image);
+};
@@ -0,0 +1,205 @@
+#include "ImGui/ShelfPacker.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+	using ImGui::ShelfPacker;
+	using Rect = ShelfPacker::Rect;
+
+	bool Overlaps(const Rect& a_lhs, const Rect& a_rhs, std::uint32_t a_padding)
+	{
+		return a_lhs.x < a_rhs.x + a_rhs.w + a_padding && a_rhs.x < a_lhs.x + a_lhs.w + a_padding &&
+		       a_lhs.y < a_rhs.y + a_rhs.h + a_padding && a_rhs.y < a_lhs.y + a_lhs.h + a_padding;
+	}
+
+	void ExpectValidLayout(const ShelfPacker& a_packer, const std::vector<Rect>& a_rects, std::uint32_t a_padding)
+	{
+		for (std::size_t i = 0; i < a_rects.size(); i++) {
+			const auto& rect = a_rects[i];
+			EXPECT_GE(rect.x, a_padding);
+			EXPECT_GE(rect.y, a_padding);
+			EXPECT_LE(rect.x + rect.w + a_padding, a_packer.GetWidth());
+			EXPECT_LE(rect.y + rect.h + a_padding, a_packer.GetHeight());
+			for (std::size_t j = i + 1; j < a_rects.size(); j++) {
+				EXPECT_FALSE(Overlaps(rect, a_rects[j], a_padding)) << "rects " << i << " and " << j;
+			}
+		}
+	}
+}
+
+TEST(ShelfPacker, PacksRowWithPadding)
+{
+	ShelfPacker packer(1024);
+	packer.Reserve(64);
+
+	const auto a = packer.Insert(16, 16);
+	const auto b = packer.Insert(16, 16);
+	ASSERT_TRUE(a && b);
+
+	EXPECT_EQ(a->x, 1u);
+	EXPECT_EQ(a->y, 1u);
+	EXPECT_EQ(b->x, 18u);
+	EXPECT_EQ(b->y, 1u);
+	EXPECT_EQ(packer.GetWidth(), 64u);
+	EXPECT_EQ(packer.GetHeight(), 18u);
+}
+
+TEST(ShelfPacker, OpensShelfWhenRowIsFull)
+{
+	ShelfPacker packer(1024);
+	packer.Reserve(64);
+
+	std::vector<Rect> rects;
+	for (int i = 0; i < 4; i++) {
+		rects.push_back(*packer.Insert(20, 20));
+	}
+
+	EXPECT_EQ(rects[2].y, 1u);
+	EXPECT_EQ(rects[3].x, 1u);
+	EXPECT_EQ(rects[3].y, 22u);
+	ExpectValidLayout(packer, rects, 1);
+}
+
+TEST(ShelfPacker, FillsShortestFittingShelf)
+{
+	ShelfPacker packer(1024);
+	packer.Reserve(128);
+
+	const auto tall = packer.Insert(100, 40);
+	const auto flat = packer.Insert(100, 10);
+	const auto small = packer.Insert(10, 8);
+	ASSERT_TRUE(tall && flat && small);
+
+	EXPECT_EQ(small->y, flat->y);
+	EXPECT_EQ(small->x, 102u);
+}
+
+TEST(ShelfPacker, KeepsRectsWhenGrowing)
+{
+	ShelfPacker packer(4096);
+
+	std::vector<Rect> rects;
+	auto              width = packer.GetWidth();
+	bool              grew = false;
+
+	for (int i = 0; i < 200; i++) {
+		rects.push_back(*packer.Insert(24, 24));
+		grew |= packer.GetWidth() != width;
+		width = packer.GetWidth();
+	}
+
+	EXPECT_TRUE(grew);
+	EXPECT_TRUE(std::has_single_bit(packer.GetWidth()));
+	EXPECT_LE(packer.GetHeight(), packer.GetWidth());  // widens instead of stacking shelves past a square
+	ExpectValidLayout(packer, rects, 1);
+}
+
+TEST(ShelfPacker, WidensForWideRect)
+{
+	ShelfPacker packer(1024);
+	packer.Reserve(32);
+
+	const auto rect = packer.Insert(100, 10);
+	ASSERT_TRUE(rect);
+	EXPECT_EQ(packer.GetWidth(), 128u);
+}
+
+TEST(ShelfPacker, ReserveOnlyGrows)
+{
+	ShelfPacker packer(1024);
+	packer.Reserve(256);
+	packer.Reserve(64);
+	EXPECT_EQ(packer.GetWidth(), 256u);
+
+	packer.Reserve(4096);
+	EXPECT_EQ(packer.GetWidth(), 1024u);
+}
+
+TEST(ShelfPacker, RejectsRectLargerThanMax)
+{
+	ShelfPacker packer(64);
+
+	EXPECT_FALSE(packer.Insert(63, 8));  // no room for the padding
+	EXPECT_FALSE(packer.Insert(8, 64));
+	EXPECT_FALSE(packer.Insert(0, 8));
+	EXPECT_TRUE(packer.Insert(62, 62));
+}
+
+TEST(ShelfPacker, OverflowsWhenFull)
+{
+	ShelfPacker packer(64);
+
+	std::vector<Rect> rects;
+	while (auto rect = packer.Insert(14, 14)) {
+		rects.push_back(*rect);
+		ASSERT_LT(rects.size(), 64u);
+	}
+
+	EXPECT_EQ(rects.size(), 16u);  // 4x4 of 14 + padding in 64
+	EXPECT_EQ(packer.GetWidth(), 64u);
+	EXPECT_LE(packer.GetHeight(), 64u);
+	ExpectValidLayout(packer, rects, 1);
+
+	// a failed insert leaves the atlas usable for rects that still fit
+	EXPECT_TRUE(packer.Insert(2, 2));
+}
+
+TEST(ShelfPacker, RandomRectsNeverOverlap)
+{
+	std::mt19937                                 rng(42);
+	std::uniform_int_distribution<std::uint32_t> size(1, 96);
+
+	ShelfPacker       packer(2048, 2);
+	std::vector<Rect> rects;
+
+	for (int i = 0; i < 500; i++) {
+		const auto rect = packer.Insert(size(rng), size(rng));
+		ASSERT_TRUE(rect);
+		rects.push_back(*rect);
+	}
+
+	ExpectValidLayout(packer, rects, 2);
+}
+
+TEST(ShelfPacker, BatchKeepsInputOrder)
+{
+	std::mt19937                                 rng(7);
+	std::uniform_int_distribution<std::uint32_t> size(1, 64);
+
+	std::vector<ShelfPacker::Size> sizes(150);
+	for (auto& [w, h] : sizes) {
+		w = size(rng);
+		h = size(rng);
+	}
+
+	ShelfPacker packer(2048);
+	const auto  batch = packer.InsertBatch(sizes);
+	ASSERT_EQ(batch.size(), sizes.size());
+
+	std::vector<Rect> rects;
+	for (std::size_t i = 0; i < batch.size(); i++) {
+		ASSERT_TRUE(batch[i]);
+		EXPECT_EQ(batch[i]->w, sizes[i].w);
+		EXPECT_EQ(batch[i]->h, sizes[i].h);
+		rects.push_back(*batch[i]);
+	}
+
+	ExpectValidLayout(packer, rects, 1);
+	EXPECT_LE(packer.GetHeight(), packer.GetWidth());  // starts near square instead of one tall column
+}
+
+TEST(ShelfPacker, ClearStartsOver)
+{
+	ShelfPacker packer(1024);
+	packer.Insert(300, 20);
+	packer.Clear();
+
+	EXPECT_EQ(packer.GetWidth(), 0u);
+	EXPECT_EQ(packer.GetHeight(), 0u);
+
+	const auto rect = packer.Insert(10, 10);
+	ASSERT_TRUE(rect);
+	EXPECT_EQ(rect->x, 1u);
+	EXPECT_EQ(rect->y, 1u);
+}
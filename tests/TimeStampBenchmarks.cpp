@@ -0,0 +1,49 @@
+#include "TimeStampKey.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+	std::vector<std::tm> MakeTimes(std::size_t a_count)
+	{
+		std::mt19937 rng(1);
+
+		std::vector<std::tm> times(a_count);
+		for (auto& time : times) {
+			time.tm_year = std::uniform_int_distribution(201, 210)(rng);
+			time.tm_mon = std::uniform_int_distribution(0, 11)(rng);
+			time.tm_mday = std::uniform_int_distribution(1, 31)(rng);
+			time.tm_hour = std::uniform_int_distribution(0, 23)(rng);
+			time.tm_min = std::uniform_int_distribution(0, 59)(rng);
+		}
+		return times;
+	}
+
+	void BM_GenerateTimeStamp(benchmark::State& a_state)
+	{
+		const auto times = MakeTimes(1024);
+
+		std::size_t i = 0;
+		for (auto _ : a_state) {
+			benchmark::DoNotOptimize(TimeStampKey::Generate(times[i++ % times.size()]));
+		}
+		a_state.SetItemsProcessed(a_state.iterations());
+	}
+
+	void BM_ExtractTimeStamp(benchmark::State& a_state)
+	{
+		std::vector<std::uint64_t> timeStamps;
+		for (const auto& time : MakeTimes(1024)) {
+			timeStamps.push_back(TimeStampKey::Generate(time));
+		}
+
+		std::size_t i = 0;
+		for (auto _ : a_state) {
+			benchmark::DoNotOptimize(TimeStampKey::Extract(timeStamps[i++ % timeStamps.size()]));
+		}
+		a_state.SetItemsProcessed(a_state.iterations());
+	}
+}
+
+BENCHMARK(BM_GenerateTimeStamp);
+BENCHMARK(BM_ExtractTimeStamp);
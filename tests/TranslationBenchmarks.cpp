@@ -0,0 +1,164 @@
+#include "TranslationTable.h"
+
+#include <benchmark/benchmark.h>
+
+// Translation::Manager::LoadTranslation off the game: the shipped files read whole, converted in one pass and
+// tokenized in place. The scalar converter is the byte at a time append the vectorized one replaced
+namespace
+{
+	std::string ReadFile(const std::filesystem::path& a_path)
+	{
+		std::ifstream file(a_path, std::ios::binary | std::ios::ate);
+		std::string   bytes(static_cast<std::size_t>(file.tellg()), '\0');
+		file.seekg(0);
+		file.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+		return bytes;
+	}
+
+	std::vector<std::filesystem::path> TranslationFiles()
+	{
+		std::vector<std::filesystem::path> files;
+		for (const auto& entry : std::filesystem::directory_iterator(TRANSLATIONS_DIR)) {
+			if (entry.path().extension() == ".txt") {
+				files.push_back(entry.path());
+			}
+		}
+		std::ranges::sort(files);
+		return files;
+	}
+
+	// a_units UTF-16 LE units of translation text, a_cjk in every 64 is a CJK ideograph
+	std::string MakeText(std::size_t a_units, std::size_t a_cjk)
+	{
+		constexpr auto line = "$DH_Title_Conversation\tConversation History\r\n"sv;
+
+		std::mt19937                                 rng(1);
+		std::uniform_int_distribution<std::uint16_t> ideograph(0x4E00, 0x9FFF);
+
+		std::string bytes;
+		bytes.reserve(a_units * 2);
+		for (std::size_t i = 0; i < a_units; i++) {
+			const auto unit = i % 64 < a_cjk ? ideograph(rng) : static_cast<std::uint16_t>(line[i % line.size()]);
+			bytes += static_cast<char>(unit & 0xFF);
+			bytes += static_cast<char>(unit >> 8);
+		}
+		return bytes;
+	}
+
+	std::optional<std::string> ScalarUTF16ToUTF8(std::string_view a_bytes)
+	{
+		if (a_bytes.size() % 2 != 0) {
+			return std::nullopt;
+		}
+
+		const auto unit_at = [&](std::size_t a_index) -> char32_t {
+			return static_cast<std::uint8_t>(a_bytes[a_index * 2]) | static_cast<std::uint8_t>(a_bytes[a_index * 2 + 1]) << 8;
+		};
+
+		const auto count = a_bytes.size() / 2;
+
+		std::string result;
+		result.reserve(count * 3);
+
+		for (std::size_t i = 0; i < count; i++) {
+			auto codePoint = unit_at(i);
+			if (codePoint >= 0xD800 && codePoint < 0xDC00) {
+				const auto low = i + 1 < count ? unit_at(i + 1) : char32_t{ 0 };
+				if (low < 0xDC00 || low >= 0xE000) {
+					return std::nullopt;
+				}
+				codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+				i++;
+			} else if (codePoint >= 0xDC00 && codePoint < 0xE000) {
+				return std::nullopt;
+			}
+
+			if (codePoint < 0x80) {
+				result += static_cast<char>(codePoint);
+			} else if (codePoint < 0x800) {
+				result += static_cast<char>(0xC0 | (codePoint >> 6));
+				result += static_cast<char>(0x80 | (codePoint & 0x3F));
+			} else if (codePoint < 0x10000) {
+				result += static_cast<char>(0xE0 | (codePoint >> 12));
+				result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+				result += static_cast<char>(0x80 | (codePoint & 0x3F));
+			} else {
+				result += static_cast<char>(0xF0 | (codePoint >> 18));
+				result += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+				result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+				result += static_cast<char>(0x80 | (codePoint & 0x3F));
+			}
+		}
+
+		return result;
+	}
+
+	template <auto Convert>
+	void BM_Convert(benchmark::State& a_state)
+	{
+		const auto bytes = MakeText(static_cast<std::size_t>(a_state.range(0)), static_cast<std::size_t>(a_state.range(1)));
+
+		if (Convert(bytes) != ScalarUTF16ToUTF8(bytes)) {
+			a_state.SkipWithError("the converters disagree");
+			return;
+		}
+
+		for (auto _ : a_state) {
+			benchmark::DoNotOptimize(Convert(bytes));
+		}
+		a_state.SetBytesProcessed(static_cast<std::int64_t>(a_state.iterations() * bytes.size()));
+	}
+
+	void BM_UTF16ToUTF8(benchmark::State& a_state) { BM_Convert<Translation::UTF16ToUTF8>(a_state); }
+	void BM_UTF16ToUTF8Scalar(benchmark::State& a_state) { BM_Convert<ScalarUTF16ToUTF8>(a_state); }
+
+	// every shipped language, as BuildTranslationMap and its English fallback would load it
+	void BM_LoadTranslation(benchmark::State& a_state)
+	{
+		const auto files = TranslationFiles();
+		if (files.empty()) {
+			a_state.SkipWithError("no translation files in " TRANSLATIONS_DIR);
+			return;
+		}
+
+		std::size_t bytes = 0;
+		for (auto _ : a_state) {
+			for (const auto& path : files) {
+				const auto buffer = ReadFile(path);
+				if (!Translation::HasBOM(buffer)) {
+					a_state.SkipWithError("a shipped file has no BOM");
+					return;
+				}
+				const auto contents = Translation::UTF16ToUTF8(std::string_view(buffer).substr(2));
+				if (!contents) {
+					a_state.SkipWithError("a shipped file isn't UTF-16");
+					return;
+				}
+
+				// Manager::AddTranslation
+				std::array<std::string, Translation::keys.size()> translations{};
+				std::map<std::string, std::string, std::less<>>   translationMap{};
+				Translation::ForEachEntry(*contents, [&](std::string_view a_key, std::string_view a_value) {
+					if (const auto index = Translation::FindKey(a_key)) {
+						if (auto& translation = translations[*index]; translation.empty()) {
+							translation = a_value;
+						}
+					} else {
+						translationMap.emplace(a_key, a_value);
+					}
+				});
+
+				benchmark::DoNotOptimize(translations.data());
+				benchmark::DoNotOptimize(translationMap.size());
+				bytes += buffer.size();
+			}
+		}
+		a_state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+		a_state.counters["files"] = static_cast<double>(files.size());
+	}
+}
+
+// units, CJK ideographs in every 64 units
+BENCHMARK(BM_UTF16ToUTF8)->ArgsProduct({ { 4096, 1 << 20 }, { 0, 4, 64 } });
+BENCHMARK(BM_UTF16ToUTF8Scalar)->ArgsProduct({ { 4096, 1 << 20 }, { 0, 4, 64 } });
+BENCHMARK(BM_LoadTranslation);
@@ -0,0 +1,156 @@
+#include "TranslationTable.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+	using Entries = std::vector<std::pair<std::string, std::string>>;
+
+	Entries Parse(std::string_view a_contents)
+	{
+		Entries entries;
+		Translation::ForEachEntry(a_contents, [&](std::string_view a_key, std::string_view a_value) {
+			entries.emplace_back(a_key, a_value);
+		});
+		return entries;
+	}
+
+	// the game reads UTF-16 LE with a BOM, std::nullopt if the file isn't that
+	std::optional<std::string> ReadTranslationFile(const std::filesystem::path& a_path)
+	{
+		std::ifstream     file(a_path, std::ios::binary);
+		const std::string bytes{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+		if (!Translation::HasBOM(bytes)) {
+			return std::nullopt;
+		}
+		return Translation::UTF16ToUTF8(std::string_view(bytes).substr(2));
+	}
+
+	std::vector<std::filesystem::path> TranslationFiles()
+	{
+		std::vector<std::filesystem::path> files;
+		for (const auto& entry : std::filesystem::directory_iterator(TRANSLATIONS_DIR)) {
+			if (entry.path().extension() == ".txt") {
+				files.push_back(entry.path());
+			}
+		}
+		std::ranges::sort(files);
+		return files;
+	}
+}
+
+TEST(Translation, ParsesTabSeparatedLines)
+{
+	const auto entries = Parse("$DH_A\tHello\r\n$DH_B\tTwo words\r\n");
+
+	EXPECT_EQ(entries, (Entries{ { "$DH_A", "Hello" }, { "$DH_B", "Two words" } }));
+}
+
+TEST(Translation, SkipsBlankLines)
+{
+	const auto entries = Parse("\r\n  \t\r\n$DH_A\tHello\n\n");
+
+	EXPECT_EQ(entries, (Entries{ { "$DH_A", "Hello" } }));
+}
+
+TEST(Translation, TrimsKeyAndValue)
+{
+	const auto entries = Parse("  $DH_A \t  Hello there \n");
+
+	EXPECT_EQ(entries, (Entries{ { "$DH_A", "Hello there" } }));
+}
+
+TEST(Translation, KeyWithoutValue)
+{
+	EXPECT_EQ(Parse("$DH_A"), (Entries{ { "$DH_A", "" } }));
+	EXPECT_EQ(Parse("$DH_A\t\r\n"), (Entries{ { "$DH_A", "" } }));
+}
+
+TEST(Translation, LastLineWithoutNewline)
+{
+	const auto entries = Parse("$DH_A\tOne\n$DH_B\tTwo");
+
+	EXPECT_EQ(entries, (Entries{ { "$DH_A", "One" }, { "$DH_B", "Two" } }));
+}
+
+TEST(Translation, KeepsMultibyteValues)
+{
+	const auto entries = Parse("$DH_A\t对话历史\r\n");
+
+	EXPECT_EQ(entries, (Entries{ { "$DH_A", "对话历史" } }));
+}
+
+TEST(Translation, DecodesUTF16)
+{
+	// "Aé对" and U+1F600 as a surrogate pair
+	const auto contents = Translation::UTF16ToUTF8("A\0\xE9\0\xF9\x5B\x3D\xD8\x00\xDE"sv);
+
+	ASSERT_TRUE(contents);
+	EXPECT_EQ(*contents, "A\xC3\xA9\xE5\xAF\xB9\xF0\x9F\x98\x80");
+}
+
+// ASCII runs are narrowed 8 units at a time, other units break the run anywhere in it
+TEST(Translation, DecodesAcrossASCIIRuns)
+{
+	std::string bytes;
+	std::string expected;
+	for (std::size_t i = 0; i < 64; i++) {
+		if (i % 11 == 10) {
+			bytes += "\xE9\0"sv;
+			expected += "\xC3\xA9";
+		} else {
+			bytes += static_cast<char>('a' + i % 26);
+			bytes += '\0';
+			expected += static_cast<char>('a' + i % 26);
+		}
+	}
+	bytes += "\x3D\xD8\x00\xDE" "z\0"sv;
+	expected += "\xF0\x9F\x98\x80z";
+
+	EXPECT_EQ(Translation::UTF16ToUTF8(bytes), expected);
+	EXPECT_FALSE(Translation::UTF16ToUTF8(bytes + std::string("\x00\xDE"sv)));
+}
+
+TEST(Translation, RejectsUnpairedSurrogates)
+{
+	EXPECT_FALSE(Translation::UTF16ToUTF8("\x3D\xD8"sv));
+	EXPECT_FALSE(Translation::UTF16ToUTF8("\x00\xDE" "A\0"sv));
+	EXPECT_FALSE(Translation::UTF16ToUTF8("A"sv));
+}
+
+TEST(Translation, FindKeyMatchesTable)
+{
+	for (std::size_t i = 0; i < Translation::keys.size(); i++) {
+		EXPECT_EQ(Translation::FindKey(Translation::keys[i]), i);
+	}
+	EXPECT_FALSE(Translation::FindKey("$DH_NotAKey"));
+	EXPECT_FALSE(Translation::FindKey(""));
+}
+
+TEST(Translation, ShippedFilesResolveEveryKey)
+{
+	const auto files = TranslationFiles();
+	ASSERT_FALSE(files.empty()) << TRANSLATIONS_DIR;
+
+	for (const auto& path : files) {
+		SCOPED_TRACE(path.filename().string());
+
+		const auto contents = ReadTranslationFile(path);
+		ASSERT_TRUE(contents) << "not UTF-16 LE with a BOM";
+
+		std::map<std::string, std::string, std::less<>> entries;
+		Translation::ForEachEntry(*contents, [&](std::string_view a_key, std::string_view a_value) {
+			EXPECT_TRUE(a_key.starts_with('$')) << a_key;
+			EXPECT_TRUE(entries.emplace(a_key, a_value).second) << "duplicate " << a_key;
+		});
+
+		for (const auto key : Translation::keys) {
+			const auto it = entries.find(key);
+			ASSERT_NE(it, entries.end()) << "missing " << key;
+			EXPECT_FALSE(it->second.empty()) << "empty " << key;
+		}
+	}
+}
@@ -0,0 +1,291 @@
+#include "VoicePlayer.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+	using namespace Voice;
+	using clock = Player::clock;
+
+	// records backend calls, sounds play until Finish
+	class StubBackend : public IVoiceBackend
+	{
+	public:
+		SoundID Build(const std::string& a_path) override
+		{
+			builds.push_back(a_path);
+			if (missing.contains(a_path)) {
+				return 0;
+			}
+			paths[nextID] = a_path;
+			return nextID++;
+		}
+
+		void Play(SoundID a_sound) override
+		{
+			plays.push_back(paths.at(a_sound));
+			playing.insert(a_sound);
+		}
+
+		bool IsPlaying(SoundID a_sound) const override
+		{
+			return playing.contains(a_sound);
+		}
+
+		void Release(SoundID a_sound) override
+		{
+			releases.push_back(paths.at(a_sound));
+			playing.erase(a_sound);
+			paths.erase(a_sound);
+		}
+
+		void FinishAll()
+		{
+			playing.clear();
+		}
+
+		std::size_t LiveSounds() const
+		{
+			return paths.size();
+		}
+
+		// members
+		std::vector<std::string>       builds;
+		std::vector<std::string>       plays;
+		std::vector<std::string>       releases;
+		std::set<std::string>          missing;
+		std::map<SoundID, std::string> paths;
+		std::set<SoundID>              playing;
+		SoundID                        nextID{ 1 };
+	};
+
+	struct Frames
+	{
+		// one frame: Update first, then the draw reports the hovered line
+		void Step(const std::string& a_hovered = {}, std::chrono::milliseconds a_elapsed = 16ms)
+		{
+			now += a_elapsed;
+			player.Update(now);
+			if (!a_hovered.empty()) {
+				player.Hover(a_hovered, now);
+			}
+		}
+
+		void Run(const std::string& a_hovered, std::chrono::milliseconds a_duration)
+		{
+			for (auto elapsed = 0ms; elapsed < a_duration; elapsed += 16ms) {
+				Step(a_hovered);
+			}
+		}
+
+		// members
+		StubBackend       backend;
+		Player            player{ backend };
+		clock::time_point now{};
+	};
+}
+
+TEST(VoicePlayer, HoverWaitsForDelay)
+{
+	Frames frames;
+
+	frames.Run("a.fuz", 128ms);
+	EXPECT_TRUE(frames.backend.builds.empty());
+
+	frames.Run("a.fuz", 64ms);
+	EXPECT_EQ(frames.backend.builds, (std::vector<std::string>{ "a.fuz" }));
+	EXPECT_EQ(frames.player.GetPrefetched(), "a.fuz");
+
+	frames.Run("a.fuz", 1s);
+	EXPECT_EQ(frames.backend.builds.size(), 1u);
+}
+
+// sweeping the mouse over a list builds nothing
+TEST(VoicePlayer, SweepingHoverBuildsNothing)
+{
+	Frames frames;
+
+	for (int i = 0; i < 100; i++) {
+		frames.Run(std::to_string(i) + ".fuz", 48ms);
+	}
+	EXPECT_TRUE(frames.backend.builds.empty());
+}
+
+TEST(VoicePlayer, HoverEndsWhenNotReported)
+{
+	Frames frames;
+
+	frames.Run("a.fuz", 100ms);
+	frames.Step();
+	frames.Run("a.fuz", 100ms);  // timer restarted
+	EXPECT_TRUE(frames.backend.builds.empty());
+}
+
+TEST(VoicePlayer, PlayStartsOnNextUpdate)
+{
+	Frames frames;
+
+	frames.player.Play("a.fuz");
+	EXPECT_TRUE(frames.backend.builds.empty());
+
+	frames.Step();
+	EXPECT_EQ(frames.backend.plays, (std::vector<std::string>{ "a.fuz" }));
+	EXPECT_EQ(frames.player.GetCurrent(), "a.fuz");
+}
+
+TEST(VoicePlayer, PlayUsesPrefetchedSound)
+{
+	Frames frames;
+
+	frames.Run("a.fuz", 200ms);
+	frames.player.Play("a.fuz");
+	frames.Step("a.fuz");
+
+	EXPECT_EQ(frames.backend.builds, (std::vector<std::string>{ "a.fuz" }));
+	EXPECT_EQ(frames.backend.plays, (std::vector<std::string>{ "a.fuz" }));
+	EXPECT_TRUE(frames.player.GetPrefetched().empty());
+
+	frames.Run("a.fuz", 1s);  // the hovered line is playing, nothing to prefetch
+	EXPECT_EQ(frames.backend.builds.size(), 1u);
+}
+
+TEST(VoicePlayer, PlayFadesOutCurrentLine)
+{
+	Frames frames;
+
+	frames.player.Play("a.fuz");
+	frames.Step();
+	frames.player.Play("b.fuz");
+
+	EXPECT_EQ(frames.backend.releases, (std::vector<std::string>{ "a.fuz" }));
+	frames.Step();
+	EXPECT_EQ(frames.player.GetCurrent(), "b.fuz");
+}
+
+TEST(VoicePlayer, ConversationPlaysInOrder)
+{
+	Frames frames;
+
+	frames.player.PlayConversation({ "a.fuz", "", "b.fuz", "c.fuz" });
+	EXPECT_EQ(frames.player.GetQueueSize(), 3u);
+
+	frames.Step();  // builds and starts a
+	frames.Step();  // prefetches b
+	EXPECT_EQ(frames.player.GetPrefetched(), "b.fuz");
+
+	frames.Run({}, 1s);
+	EXPECT_EQ(frames.backend.plays.size(), 1u);  // a is still playing
+
+	frames.backend.FinishAll();
+	frames.Step();  // starts b from the prefetch slot, prefetches c
+	EXPECT_EQ(frames.player.GetCurrent(), "b.fuz");
+	EXPECT_EQ(frames.player.GetPrefetched(), "c.fuz");
+
+	frames.Step();
+	frames.backend.FinishAll();
+	frames.Step();
+
+	EXPECT_EQ(frames.backend.plays, (std::vector<std::string>{ "a.fuz", "b.fuz", "c.fuz" }));
+	EXPECT_EQ(frames.backend.builds, frames.backend.plays);  // each line built once
+	EXPECT_EQ(frames.player.GetQueueSize(), 0u);
+}
+
+TEST(VoicePlayer, AtMostOneBuildPerFrame)
+{
+	Frames frames;
+
+	frames.player.PlayConversation({ "a.fuz", "b.fuz", "c.fuz", "d.fuz" });
+
+	std::size_t builds = 0;
+	for (int i = 0; i < 20; i++) {
+		if (i % 3 == 2) {
+			frames.backend.FinishAll();  // each line plays for two frames
+		}
+		frames.Step("x.fuz");
+		EXPECT_LE(frames.backend.builds.size() - builds, 1u) << "frame " << i;
+		builds = frames.backend.builds.size();
+	}
+	EXPECT_EQ(frames.backend.plays.size(), 4u);
+}
+
+// queued lines own the prefetch slot while a conversation replays
+TEST(VoicePlayer, QueueBeatsHover)
+{
+	Frames frames;
+
+	frames.player.PlayConversation({ "a.fuz", "b.fuz" });
+	frames.Run("x.fuz", 500ms);
+
+	EXPECT_EQ(frames.player.GetPrefetched(), "b.fuz");
+	EXPECT_EQ(std::ranges::count(frames.backend.builds, "x.fuz"), 0);
+}
+
+TEST(VoicePlayer, SkipsLineThatNeverStarts)
+{
+	Frames frames;
+
+	frames.player.PlayConversation({ "a.fuz", "b.fuz" });
+	frames.Step();
+	frames.backend.FinishAll();  // a stops before ever reporting as playing
+
+	frames.Run({}, 900ms);
+	EXPECT_EQ(frames.player.GetCurrent(), "a.fuz");
+
+	frames.Run({}, 200ms);
+	EXPECT_EQ(frames.player.GetCurrent(), "b.fuz");
+}
+
+TEST(VoicePlayer, MissingFileSkipsToNextLine)
+{
+	Frames frames;
+	frames.backend.missing = { "a.fuz" };
+
+	frames.player.PlayConversation({ "a.fuz", "b.fuz" });
+	frames.Step();
+	EXPECT_TRUE(frames.backend.plays.empty());
+
+	frames.Step();
+	EXPECT_EQ(frames.backend.plays, (std::vector<std::string>{ "b.fuz" }));
+}
+
+TEST(VoicePlayer, MissingHoveredFileIsBuiltOnce)
+{
+	Frames frames;
+	frames.backend.missing = { "a.fuz" };
+
+	frames.Run("a.fuz", 1s);
+	EXPECT_EQ(frames.backend.builds.size(), 1u);
+}
+
+TEST(VoicePlayer, ResetReleasesEverything)
+{
+	Frames frames;
+
+	frames.player.PlayConversation({ "a.fuz", "b.fuz", "c.fuz" });
+	frames.Step();
+	frames.Step();
+	frames.player.Reset();
+
+	EXPECT_EQ(frames.backend.LiveSounds(), 0u);
+	EXPECT_TRUE(frames.player.GetCurrent().empty());
+	EXPECT_EQ(frames.player.GetQueueSize(), 0u);
+
+	frames.Run({}, 2s);
+	EXPECT_EQ(frames.backend.plays.size(), 1u);
+}
+
+// the player is destroyed at exit after the audio manager, only Reset touches the backend
+TEST(VoicePlayer, DestructionLeavesBackendAlone)
+{
+	StubBackend backend;
+	{
+		Player player{ backend };
+		player.PlayConversation({ "a.fuz", "b.fuz" });
+		player.Update(clock::time_point{} + 16ms);
+		player.Hover("c.fuz", clock::time_point{} + 16ms);
+		player.Update(clock::time_point{} + 1s);
+	}
+
+	EXPECT_EQ(backend.plays, (std::vector<std::string>{ "a.fuz" }));
+	EXPECT_TRUE(backend.releases.empty());
+}